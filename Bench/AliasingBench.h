@@ -0,0 +1,450 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <juce_dsp/juce_dsp.h>
+#include "BenchReport.h"
+#include "BenchUtils.h"
+#include "dsp/fuzz/FuzzCore.h"
+#include "dsp/fuzz/FuzzType.h"
+
+/**
+ * Aliasing vs CPU: every ClipType through upsample → FuzzCore → downsample at every
+ * oversampling factor (1x–8x) and every JUCE half-band filter option, measured for
+ * spectral quality and cost, with the Pareto front marked per clip type and drive.
+ *
+ * Test signals are placed on FFT bins so nothing leaks: every tone sits on an odd bin k
+ * of a 2^fftOrder-point Blackman-Harris FFT. Harmonics (and, for the multitone, every
+ * intermodulation product) then fall on multiples of the grid bin, while an alias — a
+ * component folded back around Nyquist to bin N - n·k — sits N mod k bins off that grid
+ * (m·N mod k after m folds). Odd k keeps it off the grid bin itself, but not out of the
+ * grid bin's window lobe, so the grid bin is also chosen with min(N mod k, k - N mod k)
+ * > 2·lobe for every fold: an alias lobe and a harmonic lobe never overlap. Off-grid
+ * energy is therefore aliasing (plus the chain's noise floor), without needing a
+ * reference. The bench checks every alias bin and fails if a placement breaks this.
+ *
+ *   aliasBelowFundamentalDb  stepped sine sweep (sweepPoints log-spaced tones): worst
+ *                            energy between DC and the fundamental, dBc
+ *   thdnDb                   same sweep: worst energy in everything but the fundamental
+ *   spurDb                   worst single off-grid bin (sweep and multitone), dBc
+ *   multitoneAliasDb         three tones at 3g, 5g, 7g: off-grid energy vs the tones
+ *   nsPerSample              the same chain, stereo, 256-sample blocks of noise
+ *
+ * The shaper runs the way ClaymoreEngine's lane does (constant drive, no sag, tightness
+ * at its 20 Hz floor, output compensation) but with the oversampling filter under test;
+ * the shipping engine uses "iir" (polyphase IIR, max quality).
+ */
+namespace Bench
+{
+    struct AliasingOptions
+    {
+        std::vector<int>   clipTypes           { 0, 1, 2, 3, 4, 5, 6, 7 };
+        std::vector<int>   oversamplingFactors { 1, 2, 4, 8 };
+        std::vector<float> drives              { 0.5f, 1.0f };
+        double sampleRate       = 48000.0;
+        int    fftOrder         = 14;
+        int    sweepPoints      = 8;
+        double sweepLowHz       = 100.0;
+        double sweepHighHz      = 12000.0;
+        double multitoneGridHz  = 700.0;
+        float  level            = 0.5f;     // peak of each test signal (-6 dBFS)
+        double seconds          = 0.25;     // audio per CPU timing
+        int    repetitions      = 3;
+    };
+
+    namespace detail
+    {
+        struct OversamplingFilter
+        {
+            const char* name;
+            juce::dsp::Oversampling<float>::FilterType type;
+            bool maxQuality;
+        };
+
+        inline const OversamplingFilter oversamplingFilters[]
+        {
+            { "iir",      juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,  true  },
+            { "iir-fast", juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,  false },
+            { "fir",      juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true  },
+            { "fir-fast", juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, false }
+        };
+
+        /** Upsample → FuzzCore::processSample → downsample with a chosen filter, fixed settings. */
+        class AliasingChain
+        {
+        public:
+            AliasingChain (int numChannels, int maxBlockSize, double sampleRate, int oversamplingFactor,
+                           const OversamplingFilter& filter, int clipTypeToUse, float drive)
+                : oversampling (static_cast<size_t> (numChannels),
+                                static_cast<size_t> (std::log2 (oversamplingFactor)),
+                                filter.type, filter.maxQuality, false),
+                  clipType (clipTypeToUse),
+                  mappedDrive (FuzzConfig::mapDrive (drive))
+            {
+                oversampling.initProcessing (static_cast<size_t> (maxBlockSize));
+
+                states.resize (static_cast<size_t> (numChannels));
+                for (auto& state : states)
+                    state.prepare (sampleRate * oversamplingFactor);
+            }
+
+            void process (juce::AudioBuffer<float>& buffer)
+            {
+                juce::dsp::AudioBlock<float> block (buffer);
+                auto oversampledBlock = oversampling.processSamplesUp (block);
+
+                for (size_t ch = 0; ch < oversampledBlock.getNumChannels(); ++ch)
+                {
+                    auto* data = oversampledBlock.getChannelPointer (ch);
+                    for (size_t s = 0; s < oversampledBlock.getNumSamples(); ++s)
+                        data[s] = FuzzCore::processSample (data[s], mappedDrive, clipType, 0.0f, states[ch])
+                                  * FuzzConfig::outputCompensation;
+                }
+
+                oversampling.processSamplesDown (block);
+            }
+
+        private:
+            juce::dsp::Oversampling<float> oversampling;
+            std::vector<FuzzCoreState> states;
+            int   clipType;
+            float mappedDrive;
+        };
+
+        /** Bins within this distance of a tone or grid bin belong to it (Blackman-Harris
+            main lobe: ±4 bins, plus one for safety). */
+        constexpr int spectrumLobe = 5;
+
+        /** Distance from the folded bin of every harmonic n·k above Nyquist (up to 4·fs, the
+            8x band) to the nearest multiple of k — how close an alias gets to a harmonic. */
+        inline int aliasClearance (int k, int fftSize)
+        {
+            int clearance = k;
+            for (auto n = juce::int64 (fftSize / 2) / k + 1; n * k <= juce::int64 (4) * fftSize; ++n)
+            {
+                const auto wrapped = static_cast<int> ((n * k) % fftSize);
+                const int  folded  = wrapped <= fftSize / 2 ? wrapped : fftSize - wrapped;
+                const int  offGrid = folded % k;
+                clearance = juce::jmin (clearance, offGrid, k - offGrid);
+            }
+            return clearance;
+        }
+
+        /** True when no alias of k's harmonics can fall inside a harmonic's lobe. */
+        inline bool aliasesClearOfHarmonics (int k, int fftSize)
+        {
+            return aliasClearance (k, fftSize) > 2 * spectrumLobe;
+        }
+
+        /**
+         * Nearest odd FFT bin to `hz`, kept clear of DC and Nyquist, whose aliases stay out of
+         * its harmonics' lobes. A harmonic folded m times sits m·N mod k bins off the grid, so
+         * k needs min(m·N mod k, k - m·N mod k) > 2·lobe for m = 1..4 (harmonics up to 4·fs,
+         * the 8x band). Searches outward from the nearest odd bin.
+         */
+        inline int oddBin (double hz, double sampleRate, int fftSize)
+        {
+            constexpr int minBin = 4 * spectrumLobe + 3;   // k / 2 must exceed 2·lobe
+            const int maxBin  = fftSize / 2 - 13;
+            const int nearest = juce::jlimit (minBin, maxBin, juce::roundToInt (hz * fftSize / sampleRate) | 1);
+
+            auto isClear = [fftSize] (int k)
+            {
+                for (int m = 1; m <= 4; ++m)
+                {
+                    const int r = static_cast<int> ((juce::int64 (m) * fftSize) % k);
+                    if (juce::jmin (r, k - r) <= 2 * spectrumLobe)
+                        return false;
+                }
+                return true;
+            };
+
+            for (int step = 0; step <= maxBin; step += 2)
+            {
+                if (nearest - step >= minBin && isClear (nearest - step))
+                    return nearest - step;
+                if (nearest + step <= maxBin && isClear (nearest + step))
+                    return nearest + step;
+            }
+
+            return nearest;   // none clear: runAliasingBench reports it
+        }
+
+        /**
+         * Power spectrum of the chain's mono output for the given on-bin tones. Two FFT
+         * frames are processed; the first settles the filters and the second is analysed.
+         */
+        inline std::vector<double> outputPowerSpectrum (const AliasingOptions& options, int oversamplingFactor,
+                                                        const OversamplingFilter& filter, int clipType, float drive,
+                                                        const std::vector<int>& toneBins)
+        {
+            constexpr int blockSize = 256;
+            const int fftSize = 1 << options.fftOrder;
+
+            AliasingChain chain (1, blockSize, options.sampleRate, oversamplingFactor, filter, clipType, drive);
+
+            juce::AudioBuffer<float> signal (1, 2 * fftSize);
+            auto* x = signal.getWritePointer (0);
+            const float amplitude = options.level / static_cast<float> (toneBins.size());
+            for (int n = 0; n < 2 * fftSize; ++n)
+            {
+                double sum = 0.0;
+                for (const int bin : toneBins)
+                    sum += std::sin (juce::MathConstants<double>::twoPi * bin * (n % fftSize) / fftSize);
+                x[n] = amplitude * static_cast<float> (sum);
+            }
+
+            juce::AudioBuffer<float> block;
+            for (int pos = 0; pos < 2 * fftSize; pos += blockSize)
+            {
+                float* channel = x + pos;
+                block.setDataToReferTo (&channel, 1, juce::jmin (blockSize, 2 * fftSize - pos));
+                chain.process (block);
+            }
+
+            std::vector<float> frame (static_cast<size_t> (2 * fftSize), 0.0f);
+            std::copy (x + fftSize, x + 2 * fftSize, frame.begin());
+
+            juce::dsp::WindowingFunction<float> window (static_cast<size_t> (fftSize),
+                                                        juce::dsp::WindowingFunction<float>::blackmanHarris, false);
+            window.multiplyWithWindowingTable (frame.data(), static_cast<size_t> (fftSize));
+
+            juce::dsp::FFT fft (options.fftOrder);
+            fft.performFrequencyOnlyForwardTransform (frame.data(), true);
+
+            std::vector<double> power (static_cast<size_t> (fftSize / 2 + 1));
+            for (size_t b = 0; b < power.size(); ++b)
+                power[b] = static_cast<double> (frame[b]) * static_cast<double> (frame[b]);
+            return power;
+        }
+
+        struct SpectrumMetrics
+        {
+            double aliasBelowDb;
+            double thdnDb;
+            double spurDb;
+            double offGridDb;
+        };
+
+        inline double toDb (double ratio) { return 10.0 * std::log10 (juce::jmax (ratio, 1.0e-30)); }
+
+        /**
+         * Splits a spectrum into the input tones, the harmonic / IMD grid (multiples of
+         * gridBin) and everything off it. Bins within spectrumLobe of a target belong to
+         * it; bins at DC are ignored.
+         */
+        inline SpectrumMetrics analyseSpectrum (const std::vector<double>& power, int gridBin,
+                                                const std::vector<int>& toneBins)
+        {
+            constexpr int lobe = spectrumLobe;
+            const int lowestTone = *std::min_element (toneBins.begin(), toneBins.end());
+
+            double tones = 0.0, tonePeak = 0.0, others = 0.0, below = 0.0, offGrid = 0.0, offGridPeak = 0.0;
+
+            for (int b = lobe + 1; b < static_cast<int> (power.size()); ++b)
+            {
+                const double p = power[static_cast<size_t> (b)];
+
+                const bool onTone = std::any_of (toneBins.begin(), toneBins.end(),
+                                                 [b] (int tone) { return std::abs (b - tone) <= lobe; });
+                if (onTone)
+                {
+                    tones   += p;
+                    tonePeak = juce::jmax (tonePeak, p);
+                    continue;
+                }
+
+                others += p;
+
+                const int nearestGridBin = gridBin * ((b + gridBin / 2) / gridBin);
+                if (std::abs (b - nearestGridBin) <= lobe)
+                    continue;
+
+                offGrid    += p;
+                offGridPeak = juce::jmax (offGridPeak, p);
+                if (b < lowestTone - lobe)
+                    below += p;
+            }
+
+            tones    = juce::jmax (tones, 1.0e-30);
+            tonePeak = juce::jmax (tonePeak, 1.0e-30);
+            return { toDb (below / tones), toDb (others / tones), toDb (offGridPeak / tonePeak), toDb (offGrid / tones) };
+        }
+
+        /** Stereo chain cost on -12 dBFS noise, ns per sample frame (best of repetitions). */
+        inline double timeAliasingChain (const AliasingOptions& options, int oversamplingFactor,
+                                         const OversamplingFilter& filter, int clipType, float drive)
+        {
+            constexpr int blockSize = 256;
+            AliasingChain chain (2, blockSize, options.sampleRate, oversamplingFactor, filter, clipType, drive);
+
+            juce::AudioBuffer<float> signal (2, juce::jmax (blockSize * 4, static_cast<int> (options.sampleRate * options.seconds)));
+            fillNoise (signal, juce::Decibels::decibelsToGain (-12.0f));
+
+            return timeBlocks (signal, blockSize, options.repetitions,
+                               [&] (juce::AudioBuffer<float>& b) { chain.process (b); });
+        }
+
+        /** Marks, per clip type and drive, every configuration no other one beats on both axes. */
+        inline void markParetoFront (std::vector<AliasingResult>& results)
+        {
+            for (auto& r : results)
+            {
+                r.pareto = std::none_of (results.begin(), results.end(), [&r] (const AliasingResult& other)
+                {
+                    return other.clipType == r.clipType && other.drive == r.drive
+                        && other.nsPerSample <= r.nsPerSample && other.getAliasDb() <= r.getAliasDb()
+                        && (other.nsPerSample < r.nsPerSample || other.getAliasDb() < r.getAliasDb());
+                });
+            }
+        }
+
+        /** Text scatter of alias dBc (up = worse) against ns/sample; points are the oversampling factor. */
+        inline void printParetoPlot (const std::vector<AliasingResult>& points)
+        {
+            constexpr int width = 56, height = 12;
+            if (points.empty())
+                return;
+
+            double maxNs = 0.0, minDb = 0.0, maxDb = -300.0;
+            for (const auto& p : points)
+            {
+                maxNs = juce::jmax (maxNs, p.nsPerSample);
+                minDb = juce::jmin (minDb, p.getAliasDb());
+                maxDb = juce::jmax (maxDb, p.getAliasDb());
+            }
+            maxDb = juce::jmax (maxDb, minDb + 1.0);
+
+            std::vector<juce::String> rows (height, juce::String::repeatedString (" ", width));
+            for (const auto& p : points)
+            {
+                const int x = juce::jlimit (0, width - 1, juce::roundToInt ((width - 1) * p.nsPerSample / juce::jmax (maxNs, 1.0e-9)));
+                const int y = juce::jlimit (0, height - 1, juce::roundToInt ((height - 1) * (maxDb - p.getAliasDb()) / (maxDb - minDb)));
+                const auto marker = p.pareto ? juce::String ("*") : juce::String (p.oversamplingFactor);
+                rows[static_cast<size_t> (y)] = rows[static_cast<size_t> (y)].replaceSection (x, 1, marker);
+            }
+
+            for (int y = 0; y < height; ++y)
+            {
+                const double db = maxDb - (maxDb - minDb) * y / (height - 1);
+                std::printf ("  %7.1f dB |%s\n", db, rows[static_cast<size_t> (y)].toRawUTF8());
+            }
+            std::printf ("             +%s\n", juce::String::repeatedString ("-", width).toRawUTF8());
+            std::printf ("              0%*s%.1f ns/sample   (digit = oversampling factor, * = Pareto)\n",
+                         width - 2, "", maxNs);
+        }
+    }
+
+    /** Returns false (nothing measured) if a test tone's aliases could land in a harmonic lobe. */
+    inline bool runAliasingBench (const AliasingOptions& options, Report& report)
+    {
+        const int fftSize = 1 << options.fftOrder;
+
+        std::vector<int> sweepBins;
+        for (int i = 0; i < options.sweepPoints; ++i)
+        {
+            const double t  = options.sweepPoints > 1 ? static_cast<double> (i) / (options.sweepPoints - 1) : 0.0;
+            const double hz = options.sweepLowHz * std::pow (options.sweepHighHz / options.sweepLowHz, t);
+            sweepBins.push_back (detail::oddBin (hz, options.sampleRate, fftSize));
+        }
+
+        const int gridBin = detail::oddBin (options.multitoneGridHz, options.sampleRate, fftSize);
+        const std::vector<int> multitoneBins { 3 * gridBin, 5 * gridBin, 7 * gridBin };
+
+        // Aliases inside a harmonic lobe would be counted as harmonics, not aliasing
+        for (const int bin : sweepBins)
+        {
+            if (! detail::aliasesClearOfHarmonics (bin, fftSize))
+            {
+                std::fprintf (stderr, "ClaymoreBench: sweep bin %d of a %d-point FFT has aliases %d bins from a harmonic (need > %d)\n",
+                              bin, fftSize, detail::aliasClearance (bin, fftSize), 2 * detail::spectrumLobe);
+                return false;
+            }
+        }
+
+        if (! detail::aliasesClearOfHarmonics (gridBin, fftSize))
+        {
+            std::fprintf (stderr, "ClaymoreBench: multitone grid bin %d of a %d-point FFT has aliases %d bins from the grid (need > %d)\n",
+                          gridBin, fftSize, detail::aliasClearance (gridBin, fftSize), 2 * detail::spectrumLobe);
+            return false;
+        }
+
+        std::printf ("\n== Aliasing vs CPU (%.1f kHz, %d-point FFT, %d sweep tones %.0f Hz–%.0f Hz, multitone %.0f/%.0f/%.0f Hz) ==\n",
+                     options.sampleRate / 1000.0, fftSize, options.sweepPoints, options.sweepLowHz, options.sweepHighHz,
+                     multitoneBins[0] * options.sampleRate / fftSize, multitoneBins[1] * options.sampleRate / fftSize,
+                     multitoneBins[2] * options.sampleRate / fftSize);
+        std::printf ("%-11s %5s %3s %-8s %10s %9s %9s %11s %10s %7s\n",
+                     "clip", "drive", "os", "filter", "alias<f0", "THD+N", "spur", "multitone", "ns/sample", "pareto");
+
+        std::vector<AliasingResult> results;
+
+        for (const int clipType : options.clipTypes)
+        {
+            for (const float drive : options.drives)
+            {
+                for (const int factor : options.oversamplingFactors)
+                {
+                    for (const auto& filter : detail::oversamplingFilters)
+                    {
+                        // Without oversampling there is no filter to choose
+                        if (factor == 1 && &filter != &detail::oversamplingFilters[0])
+                            continue;
+
+                        AliasingResult r;
+                        r.clipType           = clipType;
+                        r.oversamplingFactor = factor;
+                        r.filter             = factor == 1 ? "none" : filter.name;
+                        r.drive              = drive;
+                        r.sampleRate         = options.sampleRate;
+                        r.aliasBelowFundamentalDb = r.thdnDb = r.spurDb = -300.0;
+
+                        for (const int bin : sweepBins)
+                        {
+                            const auto m = detail::analyseSpectrum (
+                                detail::outputPowerSpectrum (options, factor, filter, clipType, drive, { bin }), bin, { bin });
+                            r.aliasBelowFundamentalDb = juce::jmax (r.aliasBelowFundamentalDb, m.aliasBelowDb);
+                            r.thdnDb                  = juce::jmax (r.thdnDb, m.thdnDb);
+                            r.spurDb                  = juce::jmax (r.spurDb, m.spurDb);
+                        }
+
+                        const auto multitone = detail::analyseSpectrum (
+                            detail::outputPowerSpectrum (options, factor, filter, clipType, drive, multitoneBins),
+                            gridBin, multitoneBins);
+                        r.multitoneAliasDb = multitone.offGridDb;
+                        r.spurDb           = juce::jmax (r.spurDb, multitone.spurDb);
+
+                        r.nsPerSample = detail::timeAliasingChain (options, factor, filter, clipType, drive);
+                        results.push_back (r);
+                    }
+                }
+            }
+        }
+
+        detail::markParetoFront (results);
+
+        for (const auto& r : results)
+        {
+            std::printf ("%-11s %5.2f %2dx %-8s %10.1f %9.1f %9.1f %11.1f %10.2f %7s\n",
+                         clipTypeNames[r.clipType].toRawUTF8(), r.drive, r.oversamplingFactor, r.filter.toRawUTF8(),
+                         r.aliasBelowFundamentalDb, r.thdnDb, r.spurDb, r.multitoneAliasDb, r.nsPerSample,
+                         r.pareto ? "*" : "");
+            report.addAliasing (r);
+        }
+
+        // One plot per clip type at the hottest drive — where the choice matters most
+        const float plotDrive = options.drives.empty() ? 1.0f : *std::max_element (options.drives.begin(), options.drives.end());
+        for (const int clipType : options.clipTypes)
+        {
+            std::vector<AliasingResult> points;
+            for (const auto& r : results)
+                if (r.clipType == clipType && r.drive == plotDrive)
+                    points.push_back (r);
+
+            std::printf ("\n%s, drive %.2f — alias dBc vs CPU\n", clipTypeNames[clipType].toRawUTF8(), plotDrive);
+            detail::printParetoPlot (points);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,209 @@
+#include <juce_events/juce_events.h>
+#include "AliasingBench.h"
+#include "BenchReport.h"
+#include "LimiterBench.h"
+#include "MatrixBench.h"
+#include "ProcessorBench.h"
+#include "SessionBench.h"
+#include "SwitchBench.h"
+
+/**
+ * ClaymoreBench — headless performance measurements for the Claymore DSP.
+ *
+ * Usage: ClaymoreBench [repetitions] [options]
+ *
+ *   --suite=all|matrix|session|limiter|small-blocks|switch|aliasing   what to run (default:
+ *                                             all; aliasing is slow and only runs when named)
+ *   --json=<file>                             write the matrix / session / aliasing results as JSON
+ *   --reps=<n>                                repetitions per case, best is kept (default 3)
+ *   --seconds=<s>                             audio per matrix case (default 0.25)
+ *
+ * Matrix axes (comma-separated lists, default: everything):
+ *   --stages=engine,oversampling,shaper,tone,limiter,limiter-true-peak,processor
+ *   --clip=0,...,7          ClipType indices
+ *   --os=2,4,8              oversampling factors
+ *   --blocks=16,...,4096    block sizes
+ *   --rates=44100,...       sample rates in Hz
+ *   --channels=1,2
+ *   --counters              also read hardware counters per case (Linux perf_event_open):
+ *                           cycles, IPC, L1D / LLC misses, branch mispredictions
+ *
+ * Session (N instances round-robin, N doubles until p99 misses the deadline):
+ *   --session-rate=48000  --session-block=256  --session-channels=2
+ *   --deadline-ms=5       --session-seconds=2  --max-instances=4096
+ *
+ * Aliasing (clip type × oversampling × filter × drive; reuses --clip, --seconds, --reps):
+ *   --os=1,2,4,8          oversampling factors, 1 included
+ *   --drives=0.5,1        normalized drive values
+ *   --aliasing-csv=<file> write the Pareto table as CSV
+ */
+namespace
+{
+    template <typename T>
+    std::vector<T> parseList (const juce::String& text)
+    {
+        std::vector<T> values;
+        for (const auto& token : juce::StringArray::fromTokens (text, ",", ""))
+            if (token.trim().isNotEmpty())
+                values.push_back (static_cast<T> (token.trim().getDoubleValue()));
+        return values;
+    }
+
+    Bench::MatrixOptions parseMatrixOptions (const juce::ArgumentList& args, int repetitions)
+    {
+        Bench::MatrixOptions options;
+        options.repetitions = repetitions;
+
+        if (args.containsOption ("--seconds"))
+            options.seconds = juce::jmax (0.01, args.getValueForOption ("--seconds").getDoubleValue());
+
+        if (args.containsOption ("--stages"))
+            options.stages = juce::StringArray::fromTokens (args.getValueForOption ("--stages"), ",", "");
+
+        if (args.containsOption ("--clip"))
+            options.clipTypes = parseList<int> (args.getValueForOption ("--clip"));
+
+        if (args.containsOption ("--os"))
+        {
+            options.oversamplingIndices.clear();
+            for (const int factor : parseList<int> (args.getValueForOption ("--os")))
+                if (factor == 2 || factor == 4 || factor == 8)
+                    options.oversamplingIndices.push_back (factor == 2 ? 0 : (factor == 4 ? 1 : 2));
+        }
+
+        if (args.containsOption ("--blocks"))
+            options.blockSizes = parseList<int> (args.getValueForOption ("--blocks"));
+
+        if (args.containsOption ("--rates"))
+            options.sampleRates = parseList<double> (args.getValueForOption ("--rates"));
+
+        if (args.containsOption ("--channels"))
+            options.channelCounts = parseList<int> (args.getValueForOption ("--channels"));
+
+        options.hardwareCounters = args.containsOption ("--counters");
+
+        return options;
+    }
+
+    Bench::AliasingOptions parseAliasingOptions (const juce::ArgumentList& args, int repetitions)
+    {
+        Bench::AliasingOptions options;
+        options.repetitions = repetitions;
+
+        if (args.containsOption ("--seconds"))
+            options.seconds = juce::jmax (0.01, args.getValueForOption ("--seconds").getDoubleValue());
+
+        if (args.containsOption ("--clip"))
+            options.clipTypes = parseList<int> (args.getValueForOption ("--clip"));
+
+        if (args.containsOption ("--os"))
+        {
+            options.oversamplingFactors.clear();
+            for (const int factor : parseList<int> (args.getValueForOption ("--os")))
+                if (factor == 1 || factor == 2 || factor == 4 || factor == 8)
+                    options.oversamplingFactors.push_back (factor);
+        }
+
+        if (args.containsOption ("--drives"))
+        {
+            options.drives.clear();
+            for (const float drive : parseList<float> (args.getValueForOption ("--drives")))
+                options.drives.push_back (juce::jlimit (0.0f, 1.0f, drive));
+        }
+
+        return options;
+    }
+
+    Bench::SessionOptions parseSessionOptions (const juce::ArgumentList& args)
+    {
+        Bench::SessionOptions options;
+
+        auto value = [&args] (const char* option, double fallback)
+        {
+            return args.containsOption (option) ? args.getValueForOption (option).getDoubleValue() : fallback;
+        };
+
+        options.sampleRate   = juce::jmax (8000.0, value ("--session-rate", options.sampleRate));
+        options.blockSize    = juce::jmax (1, static_cast<int> (value ("--session-block", options.blockSize)));
+        options.numChannels  = juce::jlimit (1, 2, static_cast<int> (value ("--session-channels", options.numChannels)));
+        options.deadlineMs   = juce::jmax (0.01, value ("--deadline-ms", options.deadlineMs));
+        options.seconds      = juce::jmax (0.1, value ("--session-seconds", options.seconds));
+        options.maxInstances = juce::jmax (1, static_cast<int> (value ("--max-instances", options.maxInstances)));
+        return options;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+
+    // Legacy form: a bare number is the repetition count
+    int repetitions = 3;
+    if (args.size() > 0 && args[0].text.containsOnly ("0123456789"))
+        repetitions = args[0].text.getIntValue();
+    if (args.containsOption ("--reps"))
+        repetitions = args.getValueForOption ("--reps").getIntValue();
+    repetitions = juce::jmax (1, repetitions);
+
+    const auto suite = args.containsOption ("--suite") ? args.getValueForOption ("--suite") : juce::String ("all");
+
+    // APVTS needs a message manager (parameter timers) even when nothing is displayed
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ScopedNoDenormals noDenormals;
+
+    if (suite == "all" || suite == "limiter")
+        Bench::runLimiterBench (48000.0, 2, repetitions);
+
+    if (suite == "all" || suite == "small-blocks")
+        Bench::runSmallBlockBench (48000.0, repetitions);
+
+    if (suite == "all" || suite == "switch")
+        Bench::runSwitchBench (48000.0, 256, juce::jmax (5, repetitions));
+
+    const auto matrixOptions = parseMatrixOptions (args, repetitions);
+    Bench::Report report (matrixOptions.repetitions, matrixOptions.seconds);
+
+    if (suite == "all" || suite == "matrix")
+        Bench::runMatrixBench (matrixOptions, report);
+
+    if (suite == "all" || suite == "session")
+        Bench::runSessionBench (parseSessionOptions (args), report);
+
+    if (suite == "aliasing")
+    {
+        if (! Bench::runAliasingBench (parseAliasingOptions (args, repetitions), report))
+            return 1;
+
+        if (args.containsOption ("--aliasing-csv"))
+        {
+            const auto file = juce::File::getCurrentWorkingDirectory()
+                                  .getChildFile (args.getValueForOption ("--aliasing-csv"));
+            if (! report.writeAliasingCsv (file))
+            {
+                std::fprintf (stderr, "ClaymoreBench: could not write %s\n", file.getFullPathName().toRawUTF8());
+                return 1;
+            }
+
+            std::printf ("\nWrote the aliasing table to %s\n", file.getFullPathName().toRawUTF8());
+        }
+    }
+
+    if (args.containsOption ("--json"))
+    {
+        const auto file = juce::File::getCurrentWorkingDirectory()
+                              .getChildFile (args.getValueForOption ("--json"));
+        if (! report.writeJson (file))
+        {
+            std::fprintf (stderr, "ClaymoreBench: could not write %s\n", file.getFullPathName().toRawUTF8());
+            return 1;
+        }
+
+        std::printf ("\nWrote %d matrix, %d session and %d aliasing results to %s\n",
+                     static_cast<int> (report.getResults().size()),
+                     static_cast<int> (report.getSessionResults().size()),
+                     static_cast<int> (report.getAliasingResults().size()),
+                     file.getFullPathName().toRawUTF8());
+    }
+
+    return 0;
+}
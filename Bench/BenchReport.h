@@ -0,0 +1,253 @@
+#pragma once
+
+#include <vector>
+#include <juce_core/juce_core.h>
+#include "PerfCounters.h"
+#include "dsp/fuzz/FuzzType.h"
+
+/**
+ * Machine-readable ClaymoreBench results.
+ *
+ * Every measured case becomes one Result; Report collects them and writes a single JSON
+ * document (schema below) so two builds can be compared case by case via getKey().
+ *
+ *   {
+ *     "benchmark": "ClaymoreBench", "schemaVersion": 1,
+ *     "system":  { "cpu", "cpuCores", "os", "juceVersion", "buildType", "timestamp" },
+ *     "config":  { "repetitions", "secondsPerCase" },
+ *     "results": [ { "key", "stage", "clipType", "oversampling", "blockSize", "sampleRate",
+ *                    "channels", "nsPerSample", "realtimeFactor",
+ *                    "counters": { "cyclesPerSample", "instructionsPerSample", "ipc",
+ *                                  "l1dMissesPerSample", "llcMissesPerSample",
+ *                                  "branchMissesPerSample" } }, ... ]   (counters: --counters only)
+ *     "session": [ { "instances", "blockSize", "sampleRate", "deadlineMs", "callbacks",
+ *                    "cpuPercent", "p50Ms", "p99Ms", "maxMs", "deadlineMisses",
+ *                    "bytesPerInstance" }, ... ]        (only when the session suite ran)
+ *     "aliasing": [ { "clipType", "oversampling", "filter", "drive", "sampleRate",
+ *                     "aliasBelowFundamentalDb", "thdnDb", "spurDb", "multitoneAliasDb",
+ *                     "aliasDb", "nsPerSample", "pareto" }, ... ]   (only when the aliasing suite ran)
+ *   }
+ *
+ * nsPerSample is per channel frame (one sample on every channel); realtimeFactor is how
+ * many times faster than real time the case ran on one core. Axes that do not apply to
+ * a stage (clip type / oversampling for the tone filter and limiter) are null, as are
+ * hardware counters the machine could not provide.
+ */
+namespace Bench
+{
+    struct Result
+    {
+        juce::String stage;
+        int    clipType          = -1;    // ClipType, -1 = not applicable
+        int    oversamplingIndex = -1;    // 0 = 2x, 1 = 4x, 2 = 8x, -1 = not applicable
+        int    blockSize         = 0;
+        double sampleRate        = 0.0;
+        int    numChannels       = 0;
+        double nsPerSample       = 0.0;
+        PerfCounters::Values counters;    // per sample frame; all missing unless --counters
+
+        int getOversamplingFactor() const { return oversamplingIndex >= 0 ? 2 << oversamplingIndex : 0; }
+
+        double getRealtimeFactor() const
+        {
+            return nsPerSample > 0.0 ? 1.0e9 / (nsPerSample * sampleRate) : 0.0;
+        }
+
+        /** Stable identity of the case across builds, e.g. "processor/clip3/os4/b64/sr48000/ch2". */
+        juce::String getKey() const
+        {
+            juce::String key = stage;
+            if (clipType >= 0)          key << "/clip" << clipType;
+            if (oversamplingIndex >= 0) key << "/os" << getOversamplingFactor();
+            key << "/b" << blockSize << "/sr" << juce::roundToInt (sampleRate) << "/ch" << numChannels;
+            return key;
+        }
+    };
+
+    /** One step of the many-instance session run (SessionBench.h). */
+    struct SessionResult
+    {
+        int    instances        = 0;
+        int    blockSize        = 0;
+        double sampleRate       = 0.0;
+        double deadlineMs       = 0.0;
+        int    callbacks        = 0;
+        double cpuPercent       = 0.0;    // mean callback time / callback period
+        double p50Ms            = 0.0;
+        double p99Ms            = 0.0;
+        double maxMs            = 0.0;
+        int    deadlineMisses   = 0;
+        double bytesPerInstance = 0.0;    // resident memory growth / instances, 0 = unknown
+    };
+
+    /** One clip / oversampling / filter / drive point of the aliasing suite (AliasingBench.h). */
+    struct AliasingResult
+    {
+        int          clipType           = 0;
+        int          oversamplingFactor = 1;       // 1 = no oversampling
+        juce::String filter;                       // "iir", "iir-fast", "fir", "fir-fast", "none"
+        float        drive              = 0.0f;    // normalised 0-1
+        double       sampleRate         = 0.0;
+
+        // All dB relative to the input tone(s) at the output (dBc); higher = worse
+        double aliasBelowFundamentalDb = 0.0;      // worst sweep tone: energy below the fundamental
+        double thdnDb                  = 0.0;      // worst sweep tone: everything but the fundamental
+        double spurDb                  = 0.0;      // worst single non-harmonic bin (sweep + multitone)
+        double multitoneAliasDb        = 0.0;      // multitone: energy off the harmonic / IMD grid
+        double nsPerSample             = 0.0;      // stereo up → shaper → down
+        bool   pareto                  = false;    // no other config is both cheaper and cleaner
+
+        /** The quality axis of the Pareto front: the worse of the two aliasing measures. */
+        double getAliasDb() const { return juce::jmax (aliasBelowFundamentalDb, multitoneAliasDb); }
+    };
+
+    class Report
+    {
+    public:
+        Report (int repetitionsUsed, double secondsPerCaseUsed)
+            : repetitions (repetitionsUsed), secondsPerCase (secondsPerCaseUsed) {}
+
+        void add (const Result& result) { results.push_back (result); }
+        void addSession (const SessionResult& result) { sessionResults.push_back (result); }
+        void addAliasing (const AliasingResult& result) { aliasingResults.push_back (result); }
+
+        const std::vector<Result>& getResults() const { return results; }
+        const std::vector<SessionResult>& getSessionResults() const { return sessionResults; }
+        const std::vector<AliasingResult>& getAliasingResults() const { return aliasingResults; }
+
+        juce::var toVar() const
+        {
+            auto root = new juce::DynamicObject();
+            root->setProperty ("benchmark", "ClaymoreBench");
+            root->setProperty ("schemaVersion", 1);
+
+            auto system = new juce::DynamicObject();
+            system->setProperty ("cpu",         juce::SystemStats::getCpuModel());
+            system->setProperty ("cpuCores",    juce::SystemStats::getNumPhysicalCpus());
+            system->setProperty ("os",          juce::SystemStats::getOperatingSystemName());
+            system->setProperty ("juceVersion", juce::SystemStats::getJUCEVersion());
+           #if JUCE_DEBUG
+            system->setProperty ("buildType",   "Debug");
+           #else
+            system->setProperty ("buildType",   "Release");
+           #endif
+            system->setProperty ("timestamp",   juce::Time::getCurrentTime().toISO8601 (true));
+            root->setProperty ("system", juce::var (system));
+
+            auto config = new juce::DynamicObject();
+            config->setProperty ("repetitions",    repetitions);
+            config->setProperty ("secondsPerCase", secondsPerCase);
+            root->setProperty ("config", juce::var (config));
+
+            juce::Array<juce::var> list;
+            for (const auto& r : results)
+            {
+                auto entry = new juce::DynamicObject();
+                entry->setProperty ("key",            r.getKey());
+                entry->setProperty ("stage",          r.stage);
+                entry->setProperty ("clipType",       r.clipType >= 0 ? juce::var (r.clipType) : juce::var());
+                entry->setProperty ("oversampling",   r.oversamplingIndex >= 0 ? juce::var (r.getOversamplingFactor()) : juce::var());
+                entry->setProperty ("blockSize",      r.blockSize);
+                entry->setProperty ("sampleRate",     r.sampleRate);
+                entry->setProperty ("channels",       r.numChannels);
+                entry->setProperty ("nsPerSample",    r.nsPerSample);
+                entry->setProperty ("realtimeFactor", r.getRealtimeFactor());
+
+                if (r.counters.has (PerfCounters::cycles))
+                {
+                    auto value = [&r] (PerfCounters::Counter c)
+                    {
+                        return r.counters.has (c) ? juce::var (r.counters.get (c)) : juce::var();
+                    };
+
+                    auto counters = new juce::DynamicObject();
+                    counters->setProperty ("cyclesPerSample",       value (PerfCounters::cycles));
+                    counters->setProperty ("instructionsPerSample", value (PerfCounters::instructions));
+                    counters->setProperty ("ipc",                   r.counters.getIpc() >= 0.0 ? juce::var (r.counters.getIpc()) : juce::var());
+                    counters->setProperty ("l1dMissesPerSample",    value (PerfCounters::l1dMisses));
+                    counters->setProperty ("llcMissesPerSample",    value (PerfCounters::llcMisses));
+                    counters->setProperty ("branchMissesPerSample", value (PerfCounters::branchMisses));
+                    entry->setProperty ("counters", juce::var (counters));
+                }
+
+                list.add (juce::var (entry));
+            }
+            root->setProperty ("results", list);
+
+            if (! sessionResults.empty())
+            {
+                juce::Array<juce::var> session;
+                for (const auto& r : sessionResults)
+                {
+                    auto entry = new juce::DynamicObject();
+                    entry->setProperty ("instances",        r.instances);
+                    entry->setProperty ("blockSize",        r.blockSize);
+                    entry->setProperty ("sampleRate",       r.sampleRate);
+                    entry->setProperty ("deadlineMs",       r.deadlineMs);
+                    entry->setProperty ("callbacks",        r.callbacks);
+                    entry->setProperty ("cpuPercent",       r.cpuPercent);
+                    entry->setProperty ("p50Ms",            r.p50Ms);
+                    entry->setProperty ("p99Ms",            r.p99Ms);
+                    entry->setProperty ("maxMs",            r.maxMs);
+                    entry->setProperty ("deadlineMisses",   r.deadlineMisses);
+                    entry->setProperty ("bytesPerInstance", r.bytesPerInstance);
+                    session.add (juce::var (entry));
+                }
+                root->setProperty ("session", session);
+            }
+
+            if (! aliasingResults.empty())
+            {
+                juce::Array<juce::var> aliasing;
+                for (const auto& r : aliasingResults)
+                {
+                    auto entry = new juce::DynamicObject();
+                    entry->setProperty ("clipType",                r.clipType);
+                    entry->setProperty ("oversampling",            r.oversamplingFactor);
+                    entry->setProperty ("filter",                  r.filter);
+                    entry->setProperty ("drive",                   r.drive);
+                    entry->setProperty ("sampleRate",              r.sampleRate);
+                    entry->setProperty ("aliasBelowFundamentalDb", r.aliasBelowFundamentalDb);
+                    entry->setProperty ("thdnDb",                  r.thdnDb);
+                    entry->setProperty ("spurDb",                  r.spurDb);
+                    entry->setProperty ("multitoneAliasDb",        r.multitoneAliasDb);
+                    entry->setProperty ("aliasDb",                 r.getAliasDb());
+                    entry->setProperty ("nsPerSample",             r.nsPerSample);
+                    entry->setProperty ("pareto",                  r.pareto);
+                    aliasing.add (juce::var (entry));
+                }
+                root->setProperty ("aliasing", aliasing);
+            }
+
+            return juce::var (root);
+        }
+
+        bool writeJson (const juce::File& file) const
+        {
+            return file.replaceWithText (juce::JSON::toString (toVar()));
+        }
+
+        /** The aliasing suite's Pareto table as CSV, one row per configuration. */
+        bool writeAliasingCsv (const juce::File& file) const
+        {
+            juce::String csv ("clipType,clipName,oversampling,filter,drive,sampleRate,aliasBelowFundamentalDb,"
+                              "thdnDb,spurDb,multitoneAliasDb,aliasDb,nsPerSample,pareto\n");
+
+            for (const auto& r : aliasingResults)
+                csv << r.clipType << ',' << clipTypeNames[r.clipType] << ',' << r.oversamplingFactor << ','
+                    << r.filter << ',' << r.drive << ',' << r.sampleRate << ','
+                    << r.aliasBelowFundamentalDb << ',' << r.thdnDb << ',' << r.spurDb << ','
+                    << r.multitoneAliasDb << ',' << r.getAliasDb() << ',' << r.nsPerSample << ','
+                    << (r.pareto ? 1 : 0) << '\n';
+
+            return file.replaceWithText (csv);
+        }
+
+    private:
+        int    repetitions;
+        double secondsPerCase;
+        std::vector<Result> results;
+        std::vector<SessionResult> sessionResults;
+        std::vector<AliasingResult> aliasingResults;
+    };
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PerfCounters.h"
+
+/**
+ * Shared helpers for ClaymoreBench — timing and deterministic test signals.
+ *
+ * Every case processes the same pre-generated signal in host-sized blocks and is
+ * repeated; the fastest repetition is reported (least disturbed by the OS).
+ */
+namespace Bench
+{
+    /** Fill every channel with deterministic white noise at the given peak level. */
+    inline void fillNoise (juce::AudioBuffer<float>& buffer, float peak, juce::int64 seed = 1234)
+    {
+        juce::Random rng (seed);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            for (int s = 0; s < buffer.getNumSamples(); ++s)
+                data[s] = peak * (rng.nextFloat() * 2.0f - 1.0f);
+        }
+    }
+
+    /** Set a parameter in its plain (APVTS) units, the way a host automation write would. */
+    inline void setPlainValue (juce::AudioProcessorValueTreeState& apvts, const char* paramID, float value)
+    {
+        if (auto* param = apvts.getParameter (paramID))
+            param->setValueNotifyingHost (param->convertTo0to1 (value));
+    }
+
+    namespace detail
+    {
+        /**
+         * Runs `process (block)` over `work` in whole blocks of blockSize samples; `channels`
+         * is caller-owned scratch (one pointer per channel) so nothing allocates in here.
+         * Returns the number of samples processed.
+         */
+        template <typename ProcessFn>
+        int processInBlocks (juce::AudioBuffer<float>& work, int blockSize, std::vector<float*>& channels,
+                             ProcessFn&& process)
+        {
+            const int numChannels = work.getNumChannels();
+            const int numSamples  = work.getNumSamples();
+
+            juce::AudioBuffer<float> block;
+            for (int pos = 0; pos + blockSize <= numSamples; pos += blockSize)
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                    channels[static_cast<size_t> (ch)] = work.getWritePointer (ch, pos);
+
+                block.setDataToReferTo (channels.data(), numChannels, blockSize);
+                process (block);
+            }
+
+            return (numSamples / blockSize) * blockSize;
+        }
+    }
+
+    /**
+     * Time `process (block)` over the whole signal in blocks of blockSize samples.
+     * The signal is restored from `source` before each repetition (outside the timed
+     * region). Returns the best repetition in nanoseconds per sample (per channel frame).
+     */
+    template <typename ProcessFn>
+    double timeBlocks (const juce::AudioBuffer<float>& source, int blockSize, int repetitions,
+                       ProcessFn&& process)
+    {
+        juce::AudioBuffer<float> work (source.getNumChannels(), source.getNumSamples());
+        std::vector<float*> channels (static_cast<size_t> (source.getNumChannels()));
+
+        double best = 1.0e30;
+        int processed = 0;
+        for (int rep = 0; rep < repetitions; ++rep)
+        {
+            work.makeCopyOf (source, true);
+
+            const auto start = juce::Time::getHighResolutionTicks();
+            processed = detail::processInBlocks (work, blockSize, channels, process);
+            const auto elapsed = juce::Time::getHighResolutionTicks() - start;
+
+            best = std::min (best, juce::Time::highResolutionTicksToSeconds (elapsed));
+        }
+
+        return best * 1.0e9 / static_cast<double> (juce::jmax (1, processed));
+    }
+
+    /**
+     * One more pass of `process (block)` with hardware counters running around the block
+     * loop only (the signal restore is outside). Returns the counts per sample frame.
+     */
+    template <typename ProcessFn>
+    PerfCounters::Values countBlocks (const juce::AudioBuffer<float>& source, int blockSize,
+                                      PerfCounters& counters, ProcessFn&& process)
+    {
+        juce::AudioBuffer<float> work;
+        work.makeCopyOf (source, true);
+        std::vector<float*> channels (static_cast<size_t> (source.getNumChannels()));
+
+        counters.start();
+        const int processed = detail::processInBlocks (work, blockSize, channels, process);
+        return counters.stop().dividedBy (static_cast<double> (juce::jmax (1, processed)));
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "BenchUtils.h"
+#include "dsp/OutputLimiter.h"
+
+/**
+ * OutputLimiter cost: sample-peak vs true-peak detection, against the previous
+ * juce::dsp::Limiter<float> wrapper as a baseline.
+ *
+ * Two signals: quiet (-12 dBFS peak noise — exercises the below-threshold fast path)
+ * and hot (+6 dBFS peak noise — limiting every sub-block, worst case for detection).
+ */
+namespace Bench
+{
+    inline void runLimiterBench (double sampleRate, int numChannels, int repetitions)
+    {
+        const int numSamples = static_cast<int> (sampleRate * 2.0);
+
+        std::printf ("\n== OutputLimiter (%.1f kHz, %d ch) — ns/sample ==\n", sampleRate / 1000.0, numChannels);
+        std::printf ("%-8s %6s %12s %12s %12s %9s\n",
+                     "signal", "block", "juce", "sample-peak", "true-peak", "tp/sp");
+
+        for (const float peakDb : { -12.0f, 6.0f })
+        {
+            juce::AudioBuffer<float> signal (numChannels, numSamples);
+            fillNoise (signal, juce::Decibels::decibelsToGain (peakDb));
+
+            for (const int blockSize : { 64, 512 })
+            {
+                juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32> (blockSize),
+                                              static_cast<juce::uint32> (numChannels) };
+
+                juce::dsp::Limiter<float> juceLimiter;
+                juceLimiter.prepare (spec);
+                juceLimiter.setThreshold (0.0f);
+                juceLimiter.setRelease   (50.0f);
+
+                OutputLimiter samplePeak;
+                samplePeak.prepare (spec);
+
+                OutputLimiter truePeak;
+                truePeak.setTruePeak (true);
+                truePeak.prepare (spec);
+
+                const double juceNs = timeBlocks (signal, blockSize, repetitions, [&] (juce::AudioBuffer<float>& b)
+                {
+                    juce::dsp::AudioBlock<float>              block (b);
+                    juce::dsp::ProcessContextReplacing<float> context (block);
+                    juceLimiter.process (context);
+                });
+                const double spNs = timeBlocks (signal, blockSize, repetitions, [&] (juce::AudioBuffer<float>& b) { samplePeak.process (b); });
+                const double tpNs = timeBlocks (signal, blockSize, repetitions, [&] (juce::AudioBuffer<float>& b) { truePeak.process (b); });
+
+                std::printf ("%-8s %6d %12.2f %12.2f %12.2f %8.2fx\n",
+                             peakDb < 0.0f ? "quiet" : "hot", blockSize, juceNs, spNs, tpNs, tpNs / spNs);
+            }
+        }
+    }
+}
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <memory>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_dsp/juce_dsp.h>
+#include "BenchReport.h"
+#include "BenchUtils.h"
+#include "PluginProcessor.h"
+#include "dsp/ClaymoreEngine.h"
+#include "dsp/OutputLimiter.h"
+#include "dsp/fuzz/FuzzTone.h"
+
+/**
+ * Full DSP matrix: every stage over ClipType x oversampling x block size x sample rate x
+ * channel count, one Result per case.
+ *
+ * Stages:
+ *   engine            — ClaymoreEngine::process() (gate off, default drive/tone)
+ *   oversampling      — ClaymoreEngine::processOversamplingStages(), the engine's
+ *                       upsample → downsample pair alone (no clip axis)
+ *   shaper            — ClaymoreEngine::processShaperStage() (the engine's own shape
+ *                       stage) on an already-upsampled copy of the signal; reported per
+ *                       base-rate sample frame, so engine ≈ oversampling + shaper + tone
+ *   tone              — FuzzTone::applyTone() alone (no clip / oversampling axis)
+ *   limiter           — OutputLimiter, sample-peak, on +6 dBFS noise (limits constantly)
+ *   limiter-true-peak — OutputLimiter with true-peak detection, same signal
+ *   processor         — the whole ClaymoreProcessor::processBlock(), parameters set
+ *                       through the APVTS like a host would
+ *
+ * Each case gets a fresh instance, is prepared for its block size and timed over
+ * `seconds` of -12 dBFS noise (limiter: +6 dBFS), best of `repetitions`.
+ *
+ * With hardwareCounters (--counters, Linux), each case then runs one more pass with
+ * PerfCounters on: cycles, instructions and IPC, L1D / LLC misses and branch mispredictions
+ * per sample frame, printed on a second line and stored in Result::counters. The
+ * oversampling and shaper stages give the engine's parts their own counts (e.g. the
+ * per-sample ClipType branch shows up in the shaper's mispredictions, not the filters').
+ */
+namespace Bench
+{
+    struct MatrixOptions
+    {
+        juce::StringArray   stages              { "engine", "oversampling", "shaper", "tone", "limiter",
+                                                  "limiter-true-peak", "processor" };
+        std::vector<int>    clipTypes           { 0, 1, 2, 3, 4, 5, 6, 7 };
+        std::vector<int>    oversamplingIndices { 0, 1, 2 };
+        std::vector<int>    blockSizes          { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+        std::vector<double> sampleRates         { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+        std::vector<int>    channelCounts       { 1, 2 };
+        double seconds     = 0.25;
+        int    repetitions = 3;
+        bool   hardwareCounters = false;
+    };
+
+    namespace detail
+    {
+        inline void printResult (const Result& r)
+        {
+            std::printf ("%-18s %5s %4s %6d %8.1f %3d %12.2f %10.1fx\n",
+                         r.stage.toRawUTF8(),
+                         r.clipType >= 0 ? juce::String (r.clipType).toRawUTF8() : "-",
+                         r.oversamplingIndex >= 0 ? (juce::String (r.getOversamplingFactor()) + "x").toRawUTF8() : "-",
+                         r.blockSize, r.sampleRate / 1000.0, r.numChannels,
+                         r.nsPerSample, r.getRealtimeFactor());
+
+            if (! r.counters.has (PerfCounters::cycles))
+                return;
+
+            auto perKilo = [&r] (PerfCounters::Counter c)
+            {
+                return r.counters.has (c) ? juce::String (1000.0 * r.counters.get (c), 1) : juce::String ("-");
+            };
+
+            std::printf ("%-18s cycles/smp %8.1f  IPC %5.2f  per 1k samples: L1D miss %8s  LLC miss %8s  br-miss %8s\n",
+                         "", r.counters.get (PerfCounters::cycles), r.counters.getIpc(),
+                         perKilo (PerfCounters::l1dMisses).toRawUTF8(), perKilo (PerfCounters::llcMisses).toRawUTF8(),
+                         perKilo (PerfCounters::branchMisses).toRawUTF8());
+        }
+
+        /** Wall-clock timing plus, if counters are given, one counted pass. */
+        struct Measurement
+        {
+            double nsPerSample = 0.0;
+            PerfCounters::Values counters;
+        };
+
+        template <typename ProcessFn>
+        Measurement measure (const juce::AudioBuffer<float>& signal, int blockSize, int repetitions,
+                             PerfCounters* counters, ProcessFn&& process)
+        {
+            Measurement m;
+            m.nsPerSample = timeBlocks (signal, blockSize, repetitions, process);
+            if (counters != nullptr)
+                m.counters = countBlocks (signal, blockSize, *counters, process);
+            return m;
+        }
+
+        inline Measurement timeEngine (const juce::AudioBuffer<float>& signal, const juce::dsp::ProcessSpec& spec,
+                                       int clipType, int oversamplingIndex, int repetitions, PerfCounters* counters)
+        {
+            ClaymoreEngine engine;
+            engine.prepare (spec);
+            engine.setOversamplingFactor (oversamplingIndex, ClaymoreEngine::OversamplingSwitch::immediate);
+
+            ClaymoreEngine::Parameters params;
+            params.clipType = clipType;
+            engine.applyParameters (params);
+
+            return measure (signal, static_cast<int> (spec.maximumBlockSize), repetitions, counters,
+                            [&] (juce::AudioBuffer<float>& b) { engine.process (b); });
+        }
+
+        /** Filters matching the engine's for osIndex (polyphase IIR, max quality), used only
+            to prepare the shaper stage's band-limited input. */
+        inline std::unique_ptr<juce::dsp::Oversampling<float>> makeEngineOversampling (int numChannels, int oversamplingIndex,
+                                                                                       int maxBlockSize)
+        {
+            auto oversampling = std::make_unique<juce::dsp::Oversampling<float>> (
+                static_cast<size_t> (numChannels), static_cast<size_t> (oversamplingIndex + 1),
+                juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, false);
+            oversampling->initProcessing (static_cast<size_t> (maxBlockSize));
+            return oversampling;
+        }
+
+        inline Measurement timeOversampling (const juce::AudioBuffer<float>& signal, const juce::dsp::ProcessSpec& spec,
+                                             int oversamplingIndex, int repetitions, PerfCounters* counters)
+        {
+            ClaymoreEngine engine;
+            engine.prepare (spec);
+            engine.setOversamplingFactor (oversamplingIndex, ClaymoreEngine::OversamplingSwitch::immediate);
+
+            return measure (signal, static_cast<int> (spec.maximumBlockSize), repetitions, counters,
+                            [&] (juce::AudioBuffer<float>& b)
+                            {
+                                engine.processOversamplingStages (juce::dsp::AudioBlock<float> (b));
+                            });
+        }
+
+        /**
+         * ClaymoreEngine::processShaperStage() — the engine's own shape stage — on the
+         * upsampled signal, timed in oversampled blocks and scaled back to per base-rate
+         * sample frame.
+         */
+        inline Measurement timeShaper (const juce::AudioBuffer<float>& signal, const juce::dsp::ProcessSpec& spec,
+                                       int clipType, int oversamplingIndex, int repetitions, PerfCounters* counters)
+        {
+            const int numChannels = signal.getNumChannels();
+            const int factor      = 2 << oversamplingIndex;
+
+            // Band-limited input, as the shaper sees it in the engine
+            juce::AudioBuffer<float> upsampled (numChannels, signal.getNumSamples() * factor);
+            {
+                auto oversampling = makeEngineOversampling (numChannels, oversamplingIndex, signal.getNumSamples());
+                juce::AudioBuffer<float> source (signal);
+                juce::dsp::AudioBlock<float> block (source);
+                auto up = oversampling->processSamplesUp (block);
+                up.copyTo (upsampled);
+            }
+
+            ClaymoreEngine engine;
+            engine.prepare (spec);
+            engine.setOversamplingFactor (oversamplingIndex, ClaymoreEngine::OversamplingSwitch::immediate);
+
+            ClaymoreEngine::Parameters params;
+            params.clipType = clipType;
+            engine.applyParameters (params);
+
+            auto m = measure (upsampled, static_cast<int> (spec.maximumBlockSize) * factor, repetitions, counters,
+                              [&] (juce::AudioBuffer<float>& b)
+                              {
+                                  engine.processShaperStage (juce::dsp::AudioBlock<float> (b));
+                              });
+
+            m.nsPerSample *= factor;
+            for (auto& count : m.counters.counts)
+                if (count >= 0.0)
+                    count *= factor;
+            return m;
+        }
+
+        inline Measurement timeTone (const juce::AudioBuffer<float>& signal, const juce::dsp::ProcessSpec& spec,
+                                     int repetitions, PerfCounters* counters)
+        {
+            FuzzTone tone;
+            tone.prepare (spec);
+
+            return measure (signal, static_cast<int> (spec.maximumBlockSize), repetitions, counters,
+                            [&] (juce::AudioBuffer<float>& b) { tone.applyTone (b); });
+        }
+
+        inline Measurement timeLimiter (const juce::AudioBuffer<float>& signal, const juce::dsp::ProcessSpec& spec,
+                                        bool truePeak, int repetitions, PerfCounters* counters)
+        {
+            OutputLimiter limiter;
+            limiter.setTruePeak (truePeak);
+            limiter.prepare (spec);
+
+            return measure (signal, static_cast<int> (spec.maximumBlockSize), repetitions, counters,
+                            [&] (juce::AudioBuffer<float>& b) { limiter.process (b); });
+        }
+
+        inline Measurement timeProcessor (const juce::AudioBuffer<float>& signal, double sampleRate, int blockSize,
+                                          int clipType, int oversamplingIndex, int repetitions, PerfCounters* counters)
+        {
+            const int numChannels = signal.getNumChannels();
+
+            ClaymoreProcessor processor;
+            setPlainValue (processor.apvts, ParamIDs::clipType,     static_cast<float> (clipType));
+            setPlainValue (processor.apvts, ParamIDs::oversampling, static_cast<float> (oversamplingIndex));
+
+            processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+            processor.prepareToPlay (sampleRate, blockSize);
+
+            juce::MidiBuffer midi;
+            const auto m = measure (signal, blockSize, repetitions, counters,
+                                    [&] (juce::AudioBuffer<float>& b) { processor.processBlock (b, midi); });
+
+            processor.releaseResources();
+            return m;
+        }
+    }
+
+    inline void runMatrixBench (const MatrixOptions& options, Report& report)
+    {
+        std::printf ("\n== DSP matrix — ns per sample frame, realtime factor (one core) ==\n");
+        std::printf ("%-18s %5s %4s %6s %8s %3s %12s %11s\n",
+                     "stage", "clip", "os", "block", "kHz", "ch", "ns/sample", "realtime");
+
+        std::unique_ptr<PerfCounters> counters;
+        if (options.hardwareCounters)
+        {
+            counters = std::make_unique<PerfCounters>();
+            if (! counters->isAvailable())
+            {
+                std::printf ("(hardware counters unavailable: %s)\n", counters->getUnavailableReason().c_str());
+                counters.reset();
+            }
+        }
+
+        auto record = [&report] (Result r, const detail::Measurement& m)
+        {
+            r.nsPerSample = m.nsPerSample;
+            r.counters    = m.counters;
+            detail::printResult (r);
+            report.add (r);
+        };
+
+        for (const double sampleRate : options.sampleRates)
+        {
+            for (const int numChannels : options.channelCounts)
+            {
+                const int maxBlock   = options.blockSizes.empty() ? 0 : *std::max_element (options.blockSizes.begin(), options.blockSizes.end());
+                const int numSamples = juce::jmax (maxBlock * 4, static_cast<int> (sampleRate * options.seconds));
+
+                juce::AudioBuffer<float> signal (numChannels, numSamples);
+                fillNoise (signal, juce::Decibels::decibelsToGain (-12.0f));
+
+                juce::AudioBuffer<float> hotSignal (numChannels, numSamples);
+                fillNoise (hotSignal, juce::Decibels::decibelsToGain (6.0f));
+
+                for (const int blockSize : options.blockSizes)
+                {
+                    const juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32> (blockSize),
+                                                        static_cast<juce::uint32> (numChannels) };
+
+                    Result base;
+                    base.blockSize   = blockSize;
+                    base.sampleRate  = sampleRate;
+                    base.numChannels = numChannels;
+
+                    if (options.stages.contains ("tone"))
+                    {
+                        auto r = base;
+                        r.stage = "tone";
+                        record (r, detail::timeTone (signal, spec, options.repetitions, counters.get()));
+                    }
+
+                    for (const bool truePeak : { false, true })
+                    {
+                        const juce::String stage = truePeak ? "limiter-true-peak" : "limiter";
+                        if (! options.stages.contains (stage))
+                            continue;
+
+                        auto r = base;
+                        r.stage = stage;
+                        record (r, detail::timeLimiter (hotSignal, spec, truePeak, options.repetitions, counters.get()));
+                    }
+
+                    if (options.stages.contains ("oversampling"))
+                    {
+                        for (const int osIndex : options.oversamplingIndices)
+                        {
+                            auto r = base;
+                            r.stage             = "oversampling";
+                            r.oversamplingIndex = osIndex;
+                            record (r, detail::timeOversampling (signal, spec, osIndex, options.repetitions, counters.get()));
+                        }
+                    }
+
+                    for (const int clipType : options.clipTypes)
+                    {
+                        for (const int osIndex : options.oversamplingIndices)
+                        {
+                            auto r = base;
+                            r.clipType          = clipType;
+                            r.oversamplingIndex = osIndex;
+
+                            if (options.stages.contains ("engine"))
+                            {
+                                r.stage = "engine";
+                                record (r, detail::timeEngine (signal, spec, clipType, osIndex,
+                                                               options.repetitions, counters.get()));
+                            }
+
+                            if (options.stages.contains ("shaper"))
+                            {
+                                r.stage = "shaper";
+                                record (r, detail::timeShaper (signal, spec, clipType, osIndex,
+                                                               options.repetitions, counters.get()));
+                            }
+
+                            if (options.stages.contains ("processor"))
+                            {
+                                r.stage = "processor";
+                                record (r, detail::timeProcessor (signal, sampleRate, blockSize, clipType, osIndex,
+                                                                  options.repetitions, counters.get()));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined (__linux__)
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+/**
+ * Hardware performance counters for ClaymoreBench (Linux perf_event_open, user space only).
+ *
+ * Counts cycles, instructions, L1D read misses, last-level cache misses and branch
+ * mispredictions around a measured region, so a stage's ns/sample can be read as
+ * compute-bound (high IPC), memory-bound (cache misses) or branch-bound (mispredictions,
+ * e.g. the per-sample ClipType switch).
+ *
+ * Each counter is opened on its own (not as a group) so a PMU with fewer slots than
+ * counters multiplexes instead of failing; values are scaled by time enabled / running.
+ * Any counter the kernel refuses is simply missing (< 0). Counting needs
+ * /proc/sys/kernel/perf_event_paranoid <= 2 (the default on most distributions) or
+ * CAP_PERFMON; containers and VMs often expose no PMU at all. Elsewhere than Linux nothing
+ * is available and the benchmark runs without counters.
+ */
+namespace Bench
+{
+    class PerfCounters
+    {
+    public:
+        enum Counter
+        {
+            cycles,
+            instructions,
+            l1dMisses,
+            llcMisses,
+            branchMisses,
+            numCounters
+        };
+
+        /** One measured region; -1 = counter not available. */
+        struct Values
+        {
+            std::array<double, numCounters> counts { -1.0, -1.0, -1.0, -1.0, -1.0 };
+
+            bool has (Counter c) const { return counts[c] >= 0.0; }
+            double get (Counter c) const { return counts[c]; }
+
+            double getIpc() const
+            {
+                return has (cycles) && has (instructions) && counts[cycles] > 0.0
+                           ? counts[instructions] / counts[cycles] : -1.0;
+            }
+
+            /** Every available count divided by `n` (e.g. per sample frame). */
+            Values dividedBy (double n) const
+            {
+                Values v = *this;
+                for (auto& c : v.counts)
+                    if (c >= 0.0)
+                        c /= n;
+                return v;
+            }
+        };
+
+        PerfCounters()
+        {
+           #if defined (__linux__)
+            fds[cycles]       = openCounter (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            fds[instructions] = openCounter (PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            fds[branchMisses] = openCounter (PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+            fds[l1dMisses]    = openCounter (PERF_TYPE_HW_CACHE, cacheConfig (PERF_COUNT_HW_CACHE_L1D));
+            fds[llcMisses]    = openCounter (PERF_TYPE_HW_CACHE, cacheConfig (PERF_COUNT_HW_CACHE_LL));
+
+            // Some PMUs have no LL read-miss event; the generic cache-miss event is the LLC on those
+            if (fds[llcMisses] < 0)
+                fds[llcMisses] = openCounter (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+           #endif
+        }
+
+        ~PerfCounters()
+        {
+           #if defined (__linux__)
+            for (const int fd : fds)
+                if (fd >= 0)
+                    close (fd);
+           #endif
+        }
+
+        PerfCounters (const PerfCounters&) = delete;
+        PerfCounters& operator= (const PerfCounters&) = delete;
+
+        /** True if at least cycles can be counted. */
+        bool isAvailable() const { return fds[cycles] >= 0; }
+
+        /** Why nothing could be counted (for the console), empty when available. */
+        std::string getUnavailableReason() const
+        {
+           #if defined (__linux__)
+            return isAvailable() ? std::string()
+                                 : "perf_event_open failed (" + std::string (std::strerror (openError))
+                                       + ") — check /proc/sys/kernel/perf_event_paranoid or run outside a container";
+           #else
+            return "hardware counters are only read on Linux";
+           #endif
+        }
+
+        void start()
+        {
+           #if defined (__linux__)
+            for (const int fd : fds)
+            {
+                if (fd >= 0)
+                {
+                    ioctl (fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl (fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+           #endif
+        }
+
+        Values stop()
+        {
+            Values values;
+           #if defined (__linux__)
+            for (const int fd : fds)
+                if (fd >= 0)
+                    ioctl (fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            for (int c = 0; c < numCounters; ++c)
+            {
+                if (fds[c] < 0)
+                    continue;
+
+                // PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+                std::uint64_t data[3] {};
+                if (read (fds[c], data, sizeof (data)) != static_cast<ssize_t> (sizeof (data)) || data[2] == 0)
+                    continue;
+
+                values.counts[c] = static_cast<double> (data[0]) * static_cast<double> (data[1])
+                                                                    / static_cast<double> (data[2]);
+            }
+           #endif
+            return values;
+        }
+
+    private:
+       #if defined (__linux__)
+        static std::uint64_t cacheConfig (std::uint64_t cache)
+        {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        }
+
+        int openCounter (std::uint32_t type, std::uint64_t config)
+        {
+            perf_event_attr attr {};
+            attr.size           = sizeof (attr);
+            attr.type           = type;
+            attr.config         = config;
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // This thread, any CPU, no group
+            const int fd = static_cast<int> (syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fd < 0 && openError == 0)
+                openError = errno;
+            return fd;
+        }
+
+        int openError = 0;
+       #endif
+
+        std::array<int, numCounters> fds { -1, -1, -1, -1, -1 };
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "BenchUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * Full ClaymoreProcessor::processBlock() cost, driven headlessly.
+ *
+ * Small-block case: the per-call overhead that dominates at live-tracking buffer
+ * sizes (1–64 samples). Reports ns per processBlock() call and ns per sample.
+ */
+namespace Bench
+{
+    inline void runSmallBlockBench (double sampleRate, int repetitions)
+    {
+        const int numChannels = 2;
+        const int numSamples  = static_cast<int> (sampleRate);  // 1 s of audio per repetition
+
+        juce::AudioBuffer<float> signal (numChannels, numSamples);
+        fillNoise (signal, juce::Decibels::decibelsToGain (-12.0f));
+
+        std::printf ("\n== processBlock() small blocks (%.1f kHz, %d ch, default parameters) ==\n",
+                     sampleRate / 1000.0, numChannels);
+        std::printf ("%6s %14s %12s\n", "block", "ns/call", "ns/sample");
+
+        for (const int blockSize : { 1, 16, 32, 64 })
+        {
+            ClaymoreProcessor processor;
+            processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+            processor.prepareToPlay (sampleRate, blockSize);
+
+            juce::MidiBuffer midi;
+            const double nsPerSample = timeBlocks (signal, blockSize, repetitions, [&] (juce::AudioBuffer<float>& b)
+            {
+                processor.processBlock (b, midi);
+            });
+
+            std::printf ("%6d %14.1f %12.2f\n", blockSize, nsPerSample * blockSize, nsPerSample);
+
+            processor.releaseResources();
+        }
+    }
+}
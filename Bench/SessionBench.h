@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "BenchReport.h"
+#include "BenchUtils.h"
+#include "PluginProcessor.h"
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#elif JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+ #include <psapi.h>
+#endif
+
+/**
+ * Session-scale run: N ClaymoreProcessor instances with varied parameters, processed
+ * round-robin once per audio callback the way a host walks its tracks.
+ *
+ * One instance in a tight loop keeps its whole state in L1/L2; a session with 100+
+ * instances does not, and that is what this measures. Every instance owns its own
+ * buffer (a separate track), fed from a shared noise source at a per-instance offset.
+ * Instance i always gets the same randomised settings, and instances are added — never
+ * rebuilt — as N doubles, so resident memory growth divided by N is the memory cost of
+ * one prepared instance.
+ *
+ * For each N: per-callback wall time over `seconds` of audio (after a warm-up) gives
+ * p50 / p99 / max, CPU% (mean callback time / callback period) and the number of
+ * callbacks over the deadline. N doubles until p99 misses the deadline.
+ */
+namespace Bench
+{
+    struct SessionOptions
+    {
+        double sampleRate   = 48000.0;
+        int    blockSize    = 256;
+        int    numChannels  = 2;
+        double deadlineMs   = 5.0;
+        double seconds      = 2.0;
+        int    maxInstances = 4096;
+    };
+
+    namespace detail
+    {
+        /** Resident set size of this process in bytes, or 0 where unsupported. */
+        inline juce::int64 getResidentBytes()
+        {
+           #if JUCE_LINUX
+            long totalPages = 0, residentPages = 0;
+            if (auto* statm = std::fopen ("/proc/self/statm", "r"))
+            {
+                if (std::fscanf (statm, "%ld %ld", &totalPages, &residentPages) != 2)
+                    residentPages = 0;
+                std::fclose (statm);
+            }
+            return static_cast<juce::int64> (residentPages) * static_cast<juce::int64> (sysconf (_SC_PAGESIZE));
+           #elif JUCE_MAC
+            mach_task_basic_info info;
+            mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+            if (task_info (mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t> (&info), &count) == KERN_SUCCESS)
+                return static_cast<juce::int64> (info.resident_size);
+            return 0;
+           #elif JUCE_WINDOWS
+            PROCESS_MEMORY_COUNTERS counters;
+            if (K32GetProcessMemoryInfo (GetCurrentProcess(), &counters, sizeof (counters)))
+                return static_cast<juce::int64> (counters.WorkingSetSize);
+            return 0;
+           #else
+            return 0;
+           #endif
+        }
+
+        /** Deterministic, varied settings for instance `index` (same across runs and N). */
+        inline void randomiseParameters (ClaymoreProcessor& processor, int index)
+        {
+            juce::Random rng (static_cast<juce::int64> (index) * 7919 + 1);
+            auto& apvts = processor.apvts;
+
+            setPlainValue (apvts, ParamIDs::clipType,        static_cast<float> (rng.nextInt (8)));
+            setPlainValue (apvts, ParamIDs::oversampling,    static_cast<float> (rng.nextInt (3)));
+            setPlainValue (apvts, ParamIDs::drive,           rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::tightness,       rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::sag,             rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::tone,            rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::presence,        rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::inputGain,       rng.nextFloat() * 12.0f - 6.0f);
+            setPlainValue (apvts, ParamIDs::outputGain,      rng.nextFloat() * -12.0f);
+            setPlainValue (apvts, ParamIDs::mix,             0.5f + 0.5f * rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::gateEnabled,     rng.nextBool() ? 1.0f : 0.0f);
+            setPlainValue (apvts, ParamIDs::gateThreshold,   -60.0f + 30.0f * rng.nextFloat());
+            setPlainValue (apvts, ParamIDs::limiterTruePeak, rng.nextInt (4) == 0 ? 1.0f : 0.0f);
+        }
+
+        struct SessionInstance
+        {
+            std::unique_ptr<ClaymoreProcessor> processor;
+            juce::AudioBuffer<float>           buffer;
+            int                                readPosition = 0;
+        };
+    }
+
+    inline void runSessionBench (const SessionOptions& options, Report& report)
+    {
+        const double periodMs = 1000.0 * options.blockSize / options.sampleRate;
+
+        std::printf ("\n== Session: N instances round-robin (%.1f kHz, %d ch, block %d = %.2f ms, deadline %.2f ms) ==\n",
+                     options.sampleRate / 1000.0, options.numChannels, options.blockSize, periodMs, options.deadlineMs);
+        std::printf ("%6s %8s %9s %9s %9s %8s %12s\n",
+                     "N", "cpu%", "p50 ms", "p99 ms", "max ms", "misses", "KB/instance");
+
+        // 1 s of shared source audio; each instance reads it at its own offset
+        const int sourceLength = juce::jmax (options.blockSize * 4, static_cast<int> (options.sampleRate));
+        juce::AudioBuffer<float> source (options.numChannels, sourceLength);
+        fillNoise (source, juce::Decibels::decibelsToGain (-12.0f));
+
+        std::vector<detail::SessionInstance> instances;
+        juce::MidiBuffer midi;
+
+        const auto residentAtStart = detail::getResidentBytes();
+
+        auto runCallback = [&]
+        {
+            for (auto& instance : instances)
+            {
+                if (instance.readPosition + options.blockSize > sourceLength)
+                    instance.readPosition = 0;
+
+                for (int ch = 0; ch < options.numChannels; ++ch)
+                    instance.buffer.copyFrom (ch, 0, source, ch, instance.readPosition, options.blockSize);
+
+                instance.readPosition += options.blockSize;
+                instance.processor->processBlock (instance.buffer, midi);
+            }
+        };
+
+        const int warmUpCallbacks   = juce::jmax (1, static_cast<int> (0.25 * options.sampleRate / options.blockSize));
+        const int measuredCallbacks = juce::jmax (10, static_cast<int> (options.seconds * options.sampleRate / options.blockSize));
+        std::vector<double> callbackMs (static_cast<size_t> (measuredCallbacks));
+
+        for (int n = 1; n <= options.maxInstances; n *= 2)
+        {
+            // Grow the session to n instances (existing ones keep their state)
+            while (static_cast<int> (instances.size()) < n)
+            {
+                detail::SessionInstance instance;
+                instance.processor = std::make_unique<ClaymoreProcessor>();
+                detail::randomiseParameters (*instance.processor, static_cast<int> (instances.size()));
+                instance.processor->setPlayConfigDetails (options.numChannels, options.numChannels,
+                                                          options.sampleRate, options.blockSize);
+                instance.processor->prepareToPlay (options.sampleRate, options.blockSize);
+                instance.buffer.setSize (options.numChannels, options.blockSize);
+                instance.readPosition = (static_cast<int> (instances.size()) * 997) % (sourceLength - options.blockSize);
+                instances.push_back (std::move (instance));
+            }
+
+            const auto residentNow = detail::getResidentBytes();
+
+            for (int i = 0; i < warmUpCallbacks; ++i)
+                runCallback();
+
+            for (auto& ms : callbackMs)
+            {
+                const auto start = juce::Time::getHighResolutionTicks();
+                runCallback();
+                ms = 1000.0 * juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - start);
+            }
+
+            SessionResult r;
+            r.instances      = n;
+            r.blockSize      = options.blockSize;
+            r.sampleRate     = options.sampleRate;
+            r.deadlineMs     = options.deadlineMs;
+            r.callbacks      = measuredCallbacks;
+            r.deadlineMisses = static_cast<int> (std::count_if (callbackMs.begin(), callbackMs.end(),
+                                                                [&] (double ms) { return ms > options.deadlineMs; }));
+
+            double total = 0.0;
+            for (const auto ms : callbackMs)
+                total += ms;
+            r.cpuPercent = 100.0 * (total / measuredCallbacks) / periodMs;
+
+            auto sorted = callbackMs;
+            std::sort (sorted.begin(), sorted.end());
+            auto percentile = [&sorted] (double p)
+            {
+                const auto index = static_cast<size_t> (p * static_cast<double> (sorted.size() - 1) + 0.5);
+                return sorted[juce::jmin (index, sorted.size() - 1)];
+            };
+            r.p50Ms = percentile (0.50);
+            r.p99Ms = percentile (0.99);
+            r.maxMs = sorted.back();
+
+            if (residentAtStart > 0 && residentNow > residentAtStart)
+                r.bytesPerInstance = static_cast<double> (residentNow - residentAtStart) / n;
+
+            std::printf ("%6d %7.1f%% %9.3f %9.3f %9.3f %8d %12.1f\n",
+                         r.instances, r.cpuPercent, r.p50Ms, r.p99Ms, r.maxMs, r.deadlineMisses,
+                         r.bytesPerInstance / 1024.0);
+            report.addSession (r);
+
+            if (r.p99Ms > options.deadlineMs)
+            {
+                std::printf ("Deadline missed at N = %d (p99 %.3f ms > %.2f ms)\n", n, r.p99Ms, options.deadlineMs);
+                break;
+            }
+        }
+
+        for (auto& instance : instances)
+            instance.processor->releaseResources();
+    }
+}
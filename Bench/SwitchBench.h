@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <juce_dsp/juce_dsp.h>
+#include "BenchUtils.h"
+#include "dsp/ClaymoreEngine.h"
+
+/**
+ * Oversampling rate switches: the extra CPU of a crossfade, as measured by the engine
+ * itself (ClaymoreEngine::getLastOversamplingSwitchLoad()) — the incoming lane's time
+ * over the crossfade's real-time length, i.e. the share of one core the switch adds
+ * while it runs. Every from → to pair, median of `repetitions` switches, on -12 dBFS
+ * noise at the default parameters.
+ */
+namespace Bench
+{
+    inline void runSwitchBench (double sampleRate, int blockSize, int repetitions)
+    {
+        const int numChannels = 2;
+        const juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32> (blockSize),
+                                            static_cast<juce::uint32> (numChannels) };
+
+        juce::AudioBuffer<float> signal (numChannels, blockSize);
+
+        std::printf ("\n== Oversampling crossfade (%.1f kHz, block %d, %d ch) — extra load, %% of one core ==\n",
+                     sampleRate / 1000.0, blockSize, numChannels);
+        std::printf ("%4s %4s %8s %10s %10s\n", "from", "to", "blocks", "median", "worst");
+
+        for (int from = 0; from < 3; ++from)
+        {
+            for (int to = 0; to < 3; ++to)
+            {
+                if (from == to)
+                    continue;
+
+                ClaymoreEngine engine;
+                engine.prepare (spec);
+
+                std::vector<float> loads;
+                int fadeBlocks = 0;
+                juce::int64 seed = 1234;
+
+                for (int rep = 0; rep < repetitions; ++rep)
+                {
+                    engine.setOversamplingFactor (from, ClaymoreEngine::OversamplingSwitch::immediate);
+
+                    // Settle the outgoing rate, then switch and run until the fade is done
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        fillNoise (signal, juce::Decibels::decibelsToGain (-12.0f), seed++);
+                        engine.process (signal);
+                    }
+
+                    engine.setOversamplingFactor (to);
+                    for (fadeBlocks = 0; engine.isOversamplingTransitionActive(); ++fadeBlocks)
+                    {
+                        fillNoise (signal, juce::Decibels::decibelsToGain (-12.0f), seed++);
+                        engine.process (signal);
+                    }
+
+                    loads.push_back (engine.getLastOversamplingSwitchLoad());
+                }
+
+                std::sort (loads.begin(), loads.end());
+                std::printf ("%3dx %3dx %8d %9.2f%% %9.2f%%\n", 2 << from, 2 << to, fadeBlocks,
+                             100.0f * loads[loads.size() / 2], 100.0f * loads.back());
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <juce_audio_basics/juce_audio_basics.h>
+
+/**
+ * Audio thread → analysis thread sample feed for the spectrum analyzer / oscilloscope.
+ *
+ * Two streams, pre-distortion (engine input) and post-distortion (engine output), each a
+ * wait-free SPSC ring (AbstractFifo). The audio thread only downmixes each tile to mono
+ * straight into the ring with two vector ops per channel — no FFT, no allocation, and
+ * nothing at all while the analyzer is inactive (editor closed). If the analysis thread
+ * falls behind, the samples that do not fit are dropped.
+ */
+class AnalyzerFeed
+{
+public:
+    enum class Stream
+    {
+        pre,
+        post
+    };
+
+    AnalyzerFeed()
+    {
+        for (auto& ring : rings)
+            ring.samples.assign (static_cast<size_t> (capacity), 0.0f);
+    }
+
+    // --- Audio thread ---
+
+    bool isActive() const { return active.load (std::memory_order_relaxed); }
+
+    /** Called from prepareToPlay(): the analysis thread reads it to place bins. */
+    void setSampleRate (double newSampleRate) { sampleRate.store (newSampleRate, std::memory_order_relaxed); }
+
+    /** Appends the channel average of buffer to a stream. Wait-free. */
+    void push (Stream stream, const juce::AudioBuffer<float>& buffer)
+    {
+        auto& ring = rings[static_cast<size_t> (stream)];
+
+        const int numChannels = buffer.getNumChannels();
+        if (numChannels == 0)
+            return;
+
+        const float scale = 1.0f / static_cast<float> (numChannels);
+        const int   numToWrite = juce::jmin (buffer.getNumSamples(), ring.fifo.getFreeSpace());
+
+        const auto scope = ring.fifo.write (numToWrite);
+
+        auto mixInto = [&] (int ringStart, int size, int bufferOffset)
+        {
+            if (size <= 0)
+                return;
+
+            float* dest = ring.samples.data() + ringStart;
+            juce::FloatVectorOperations::copyWithMultiply (dest, buffer.getReadPointer (0, bufferOffset), scale, size);
+            for (int ch = 1; ch < numChannels; ++ch)
+                juce::FloatVectorOperations::addWithMultiply (dest, buffer.getReadPointer (ch, bufferOffset), scale, size);
+        };
+
+        mixInto (scope.startIndex1, scope.blockSize1, 0);
+        mixInto (scope.startIndex2, scope.blockSize2, scope.blockSize1);
+    }
+
+    // --- Analysis thread ---
+
+    double getSampleRate() const { return sampleRate.load (std::memory_order_relaxed); }
+
+    /** Moves up to maxSamples pending samples of a stream into dest; returns how many. */
+    int pull (Stream stream, float* dest, int maxSamples)
+    {
+        auto& ring = rings[static_cast<size_t> (stream)];
+
+        const auto scope = ring.fifo.read (juce::jmin (maxSamples, ring.fifo.getNumReady()));
+
+        if (scope.blockSize1 > 0)
+            std::copy_n (ring.samples.data() + scope.startIndex1, scope.blockSize1, dest);
+        if (scope.blockSize2 > 0)
+            std::copy_n (ring.samples.data() + scope.startIndex2, scope.blockSize2, dest + scope.blockSize1);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    /** Start/stop the audio-side copy. Stale samples are discarded on start. */
+    void setActive (bool shouldBeActive)
+    {
+        if (shouldBeActive)
+            for (auto& ring : rings)
+                ring.fifo.read (ring.fifo.getNumReady());   // consumer-side discard
+
+        active.store (shouldBeActive, std::memory_order_relaxed);
+    }
+
+private:
+    // ~340 ms at 48 kHz — several analysis frames of slack per stream
+    static constexpr int capacity = 16384;
+
+    struct Ring
+    {
+        juce::AbstractFifo fifo { capacity };
+        std::vector<float> samples;
+    };
+
+    Ring                rings[2];
+    std::atomic<bool>   active     { false };
+    std::atomic<double> sampleRate { 44100.0 };
+};
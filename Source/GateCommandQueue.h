@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <juce_core/juce_core.h>
+
+/**
+ * Wait-free single-producer / single-consumer queue carrying hidden gate setting changes
+ * from the message thread (editor right-click menu) to the audio thread.
+ *
+ * The producer writes a whole Command into a slot before AbstractFifo publishes it, and
+ * the consumer only reads published slots, so a value can never be observed half-written.
+ * Both sides are a couple of atomic loads/stores — no locks, no allocation.
+ *
+ * The audio thread drains the queue at the start of every block and calls the engine's
+ * setters there, so coefficient recomputation (attack/release, sidechain HPF cutoff)
+ * happens on the audio side, never under a running filter.
+ *
+ * Nothing is lost when the queue is full (the audio thread not draining): the producer
+ * keeps the latest value of each setting that could not be queued and sends it with the
+ * next push() or flush(), so the engine always ends up on the editor's values.
+ */
+class GateCommandQueue
+{
+public:
+    enum class Setting
+    {
+        attack,        // ms
+        release,       // ms
+        hysteresis,    // dB
+        range,         // dB
+        sidechainHPF,  // Hz
+        lookahead      // 0 = off, 1 = on
+    };
+
+    static constexpr int numSettings = 6;
+
+    struct Command
+    {
+        Setting setting = Setting::attack;
+        float   value   = 0.0f;
+    };
+
+    /**
+     * Producer side (message thread). Returns false if the queue is full — only possible
+     * if more than capacity - 1 changes are made while the audio thread is not draining;
+     * the value is then held back and resent by the next push() or flush().
+     */
+    bool push (Setting setting, float value)
+    {
+        const auto index = static_cast<size_t> (setting);
+        latest[index]  = value;
+        pending[index] = true;
+        return flush();
+    }
+
+    /** Producer side: queues every held-back setting that fits. Returns true if none is left. */
+    bool flush()
+    {
+        for (size_t index = 0; index < latest.size(); ++index)
+        {
+            if (! pending[index])
+                continue;
+
+            const auto scope = fifo.write (1);
+            if (scope.blockSize1 == 0)
+                return false;
+
+            commands[static_cast<size_t> (scope.startIndex1)] = { static_cast<Setting> (index), latest[index] };
+            pending[index] = false;
+        }
+        return true;
+    }
+
+    /** Consumer side (audio thread, or prepareToPlay): hands every pending command to apply, in order. */
+    template <typename ApplyFn>
+    void drain (ApplyFn&& apply)
+    {
+        const auto scope = fifo.read (fifo.getNumReady());
+        scope.forEach ([&] (int index) { apply (commands[static_cast<size_t> (index)]); });
+    }
+
+private:
+    static constexpr int capacity = 64;
+
+    juce::AbstractFifo            fifo { capacity };
+    std::array<Command, capacity> commands {};
+
+    // Producer side: latest value per setting, and which ones are not queued yet
+    std::array<float, numSettings> latest  {};
+    std::array<bool,  numSettings> pending {};
+};
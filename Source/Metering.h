@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <juce_audio_basics/juce_audio_basics.h>
+
+/**
+ * Lock-free metering pipeline: audio thread → editor.
+ *
+ * Once per host block the processor pushes one Frame (input/output peak and sum of
+ * squares, gate gain, lowest limiter gain) into a wait-free SPSC ring (AbstractFifo).
+ * The editor drains every pending frame on its vblank-synced timer and folds them into
+ * one Reading, so short host blocks never drop a peak between two repaints.
+ *
+ * Audio-side cost is a vectorised min/max and a sum of squares per channel, plus one
+ * slot write per block — and nothing at all while no editor is open (setActive).
+ * If the editor stalls and the ring fills, new frames are dropped; nothing blocks.
+ */
+class Metering
+{
+public:
+    /** One host block's worth of meter data. */
+    struct Frame
+    {
+        float inputPeak         = 0.0f;
+        float inputSumSquares   = 0.0f;
+        float outputPeak        = 0.0f;
+        float outputSumSquares  = 0.0f;
+        float gateGain          = 1.0f;   // gate gain at the end of the block (1 = open / off)
+        float limiterGain       = 1.0f;   // lowest limiter gain in the block (1 = no reduction)
+        int   numValues         = 0;      // samples x channels behind the sums of squares
+    };
+
+    /** Frames drained since the previous read(), folded together. */
+    struct Reading
+    {
+        float inputPeak   = 0.0f;
+        float inputRms    = 0.0f;
+        float outputPeak  = 0.0f;
+        float outputRms   = 0.0f;
+        float gateGain    = 1.0f;
+        float limiterGain = 1.0f;
+        bool  hasData     = false;   // false if the audio thread published nothing
+    };
+
+    // --- Audio thread ---
+
+    /** True while an editor is reading; the processor skips all metering work otherwise. */
+    bool isActive() const { return active.load (std::memory_order_relaxed); }
+
+    /** Adds buffer's channel-linked peak and sum of squares to a frame's running values. */
+    static void accumulate (const juce::AudioBuffer<float>& buffer, float& peak, float& sumSquares)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            const float* data = buffer.getReadPointer (ch);
+
+            const auto range = juce::FloatVectorOperations::findMinAndMax (data, numSamples);
+            peak = juce::jmax (peak, -range.getStart(), range.getEnd());
+
+            float sum = 0.0f;
+            for (int i = 0; i < numSamples; ++i)
+                sum += data[i] * data[i];
+            sumSquares += sum;
+        }
+    }
+
+    /** Publishes one frame. Wait-free; drops the frame if the ring is full. */
+    void push (const Frame& frame)
+    {
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 > 0)
+            frames[static_cast<size_t> (scope.startIndex1)] = frame;
+    }
+
+    // --- Editor (message thread) ---
+
+    /** Start/stop publishing. Frames left over from an earlier session are discarded on start. */
+    void setActive (bool shouldBeActive)
+    {
+        if (shouldBeActive)
+            read();
+
+        active.store (shouldBeActive, std::memory_order_relaxed);
+    }
+
+    /** Drains every pending frame: peaks and gain reduction take the extreme, RMS the mean. */
+    Reading read()
+    {
+        Reading reading;
+        float inputSquares = 0.0f, outputSquares = 0.0f;
+        int   numValues    = 0;
+
+        const auto scope = fifo.read (fifo.getNumReady());
+        scope.forEach ([&] (int index)
+        {
+            const auto& frame = frames[static_cast<size_t> (index)];
+
+            reading.inputPeak   = juce::jmax (reading.inputPeak,   frame.inputPeak);
+            reading.outputPeak  = juce::jmax (reading.outputPeak,  frame.outputPeak);
+            reading.limiterGain = juce::jmin (reading.limiterGain, frame.limiterGain);
+            reading.gateGain    = frame.gateGain;   // latest state
+            inputSquares  += frame.inputSumSquares;
+            outputSquares += frame.outputSumSquares;
+            numValues     += frame.numValues;
+            reading.hasData = true;
+        });
+
+        if (numValues > 0)
+        {
+            reading.inputRms  = std::sqrt (inputSquares  / static_cast<float> (numValues));
+            reading.outputRms = std::sqrt (outputSquares / static_cast<float> (numValues));
+        }
+
+        return reading;
+    }
+
+private:
+    // ~340 ms of 32-sample blocks at 48 kHz — far longer than any editor frame
+    static constexpr int capacity = 512;
+
+    juce::AbstractFifo          fifo { capacity };
+    std::array<Frame, capacity> frames {};
+    std::atomic<bool>           active { false };
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "Parameters.h"
+#include "dsp/ClaymoreEngine.h"
+
+/**
+ * Packed copy of all 14 APVTS parameters, as read by the audio thread.
+ *
+ * The engine-facing fields are grouped in ClaymoreEngine::Parameters so the engine can
+ * diff them in one applyParameters() call; the rest drive the processor's own stages.
+ */
+struct ParameterSnapshot
+{
+    // Distortion + gate (ClaymoreEngine)
+    ClaymoreEngine::Parameters engine;
+
+    // Signal chain (processor gain stages, dry/wet mixer)
+    float inputGainDB  = 0.0f;
+    float outputGainDB = 0.0f;
+    float mix          = 1.0f;
+
+    // Quality
+    int  oversamplingIndex = 0;
+    bool limiterTruePeak   = false;
+    bool adaptiveQuality   = false;
+};
+
+/**
+ * Versioned ParameterSnapshot source.
+ *
+ * Registers as an APVTS listener for every parameter; each change bumps an atomic version
+ * counter (one atomic increment on whichever thread set the parameter). The audio
+ * thread calls update() once per block: if the version is unchanged it returns false after
+ * a single atomic load, otherwise it re-reads the raw parameter atomics into the snapshot.
+ *
+ * The version is read before the values, so a change that lands mid-rebuild bumps the
+ * version again and is picked up by the next update() — a snapshot can be one block late,
+ * never permanently stale.
+ */
+class ParameterSnapshotSource final : private juce::AudioProcessorValueTreeState::Listener
+{
+public:
+    explicit ParameterSnapshotSource (juce::AudioProcessorValueTreeState& stateToUse)
+        : state (stateToUse)
+    {
+        // Cache all 14 raw parameter pointers (no string lookups on the audio thread)
+
+        // Distortion
+        driveParam     = state.getRawParameterValue (ParamIDs::drive);
+        clipTypeParam  = state.getRawParameterValue (ParamIDs::clipType);
+        tightnessParam = state.getRawParameterValue (ParamIDs::tightness);
+        sagParam       = state.getRawParameterValue (ParamIDs::sag);
+        toneParam      = state.getRawParameterValue (ParamIDs::tone);
+        presenceParam  = state.getRawParameterValue (ParamIDs::presence);
+
+        // Signal chain
+        inputGainParam     = state.getRawParameterValue (ParamIDs::inputGain);
+        outputGainParam    = state.getRawParameterValue (ParamIDs::outputGain);
+        mixParam           = state.getRawParameterValue (ParamIDs::mix);
+        gateEnabledParam   = state.getRawParameterValue (ParamIDs::gateEnabled);
+        gateThresholdParam = state.getRawParameterValue (ParamIDs::gateThreshold);
+
+        // Quality
+        oversamplingParam    = state.getRawParameterValue (ParamIDs::oversampling);
+        limiterTruePeakParam = state.getRawParameterValue (ParamIDs::limiterTruePeak);
+        adaptiveQualityParam = state.getRawParameterValue (ParamIDs::adaptiveQuality);
+
+        for (auto* id : parameterIDs)
+            state.addParameterListener (id, this);
+    }
+
+    ~ParameterSnapshotSource() override
+    {
+        for (auto* id : parameterIDs)
+            state.removeParameterListener (id, this);
+    }
+
+    /** Force the next update() to rebuild (prepareToPlay, state restore). */
+    void invalidate() { version.fetch_add (1, std::memory_order_release); }
+
+    /**
+     * Rebuild the snapshot if any parameter changed since the last call.
+     * Returns true if it was rebuilt. Audio thread (or prepareToPlay); no allocation, no locks.
+     */
+    bool update()
+    {
+        const auto currentVersion = version.load (std::memory_order_acquire);
+        if (currentVersion == lastVersion)
+            return false;
+
+        lastVersion = currentVersion;
+
+        auto load = [] (const std::atomic<float>* p) { return p->load (std::memory_order_relaxed); };
+
+        snapshot.engine.drive           = load (driveParam);
+        snapshot.engine.clipType        = static_cast<int> (load (clipTypeParam));
+        snapshot.engine.tightness       = load (tightnessParam);
+        snapshot.engine.sag             = load (sagParam);
+        snapshot.engine.tone            = load (toneParam);
+        snapshot.engine.presence        = load (presenceParam);
+        snapshot.engine.gateEnabled     = load (gateEnabledParam) >= 0.5f;
+        snapshot.engine.gateThresholdDB = load (gateThresholdParam);
+
+        snapshot.inputGainDB  = load (inputGainParam);
+        snapshot.outputGainDB = load (outputGainParam);
+        snapshot.mix          = load (mixParam);
+
+        snapshot.oversamplingIndex = static_cast<int> (load (oversamplingParam));
+        snapshot.limiterTruePeak   = load (limiterTruePeakParam) >= 0.5f;
+        snapshot.adaptiveQuality   = load (adaptiveQualityParam) >= 0.5f;
+
+        return true;
+    }
+
+    /** The snapshot as of the last update(). */
+    const ParameterSnapshot& get() const { return snapshot; }
+
+private:
+    void parameterChanged (const juce::String&, float) override
+    {
+        version.fetch_add (1, std::memory_order_release);
+    }
+
+    static constexpr const char* parameterIDs[] =
+    {
+        ParamIDs::drive, ParamIDs::clipType, ParamIDs::tightness, ParamIDs::sag,
+        ParamIDs::tone, ParamIDs::presence,
+        ParamIDs::inputGain, ParamIDs::outputGain, ParamIDs::mix,
+        ParamIDs::gateEnabled, ParamIDs::gateThreshold,
+        ParamIDs::oversampling, ParamIDs::limiterTruePeak, ParamIDs::adaptiveQuality
+    };
+
+    juce::AudioProcessorValueTreeState& state;
+
+    // Starts one ahead of lastVersion so the first update() always rebuilds
+    std::atomic<juce::uint32> version { 1 };
+    juce::uint32              lastVersion = 0;
+
+    ParameterSnapshot snapshot;
+
+    // Distortion
+    std::atomic<float>* driveParam     = nullptr;
+    std::atomic<float>* clipTypeParam  = nullptr;
+    std::atomic<float>* tightnessParam = nullptr;
+    std::atomic<float>* sagParam       = nullptr;
+    std::atomic<float>* toneParam      = nullptr;
+    std::atomic<float>* presenceParam  = nullptr;
+    // Signal chain
+    std::atomic<float>* inputGainParam     = nullptr;
+    std::atomic<float>* outputGainParam    = nullptr;
+    std::atomic<float>* mixParam           = nullptr;
+    std::atomic<float>* gateEnabledParam   = nullptr;
+    std::atomic<float>* gateThresholdParam = nullptr;
+    // Quality
+    std::atomic<float>* oversamplingParam    = nullptr;
+    std::atomic<float>* limiterTruePeakParam = nullptr;
+    std::atomic<float>* adaptiveQualityParam = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE (ParameterSnapshotSource)
+};
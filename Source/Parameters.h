@@ -6,10 +6,10 @@
 /**
  * Claymore APVTS parameter IDs and layout factory.
  *
- * All 12 parameters:
+ * All 14 parameters:
  *   Distortion: drive, clipType, tightness, sag, tone, presence
  *   Signal chain: inputGain, outputGain, mix, gateEnabled, gateThreshold
- *   Quality: oversampling
+ *   Quality: oversampling, limiterTruePeak, adaptiveQuality
  *
  * Parameter names use descriptive mixing-tool language (not GunkLord's creative names).
  */
@@ -33,6 +33,8 @@ namespace ParamIDs
 
     // Quality controls
     inline constexpr const char* oversampling   = "oversampling";
+    inline constexpr const char* limiterTruePeak = "limiterTruePeak";
+    inline constexpr const char* adaptiveQuality = "adaptiveQuality";
 }
 
 /**
@@ -148,5 +150,19 @@ inline juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
         0  // default: 2x (index 0)
     ));
 
+    // Limiter True Peak: inter-sample over detection in the output limiter
+    // Off = sample-peak ceiling (cheapest); on = 4x interpolated true-peak ceiling
+    layout.add (std::make_unique<AudioParameterBool> (
+        ParameterID { ParamIDs::limiterTruePeak, 1 },
+        "Limiter True Peak",
+        false));
+
+    // Adaptive Quality: opt-in CPU governor (QualityGovernor.h) — steps the running
+    // oversampling rate below the selected one under sustained load, at constant latency
+    layout.add (std::make_unique<AudioParameterBool> (
+        ParameterID { ParamIDs::adaptiveQuality, 1 },
+        "Adaptive Quality",
+        false));
+
     return layout;
 }
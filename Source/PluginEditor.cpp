@@ -57,6 +57,7 @@ ClaymoreEditor::ClaymoreEditor (ClaymoreProcessor& p)
         label.setFont (theme.getKnobLabelFont (11.0f));
         label.setColour (juce::Label::textColourId, juce::Colour (ClaymoreColors::labelText));
         label.setInterceptsMouseClicks (false, false);
+        label.setBufferedToImage (true);   // static text + shadow: render once, then blit
         addAndMakeVisible (label);
     };
 
@@ -88,19 +89,77 @@ ClaymoreEditor::ClaymoreEditor (ClaymoreProcessor& p)
     addAndMakeVisible (oversamplingBox);
     oversamplingAttach = std::make_unique<ComboBoxAttachment> (p.apvts, ParamIDs::oversampling, oversamplingBox);
 
+    // Adaptive quality — toggle left of the oversampling label; the vblank callback
+    // shows the running rate on it while the governor has stepped down
+    adaptiveQualityButton.setButtonText ("AUTO");
+    adaptiveQualityButton.setClickingTogglesState (true);
+    adaptiveQualityButton.setColour (juce::TextButton::buttonColourId,   juce::Colour (ClaymoreColors::surface));
+    adaptiveQualityButton.setColour (juce::TextButton::buttonOnColourId, juce::Colour (ClaymoreColors::surface));
+    adaptiveQualityButton.setColour (juce::TextButton::textColourOffId,  juce::Colour (ClaymoreColors::labelText));
+    adaptiveQualityButton.setColour (juce::TextButton::textColourOnId,   juce::Colour (ClaymoreColors::ledActive));
+    adaptiveQualityButton.setColour (juce::ComboBox::outlineColourId,    juce::Colour (ClaymoreColors::border).withAlpha (0.3f));
+    addAndMakeVisible (adaptiveQualityButton);
+    adaptiveQualityAttach = std::make_unique<ButtonAttachment> (p.apvts, ParamIDs::adaptiveQuality, adaptiveQualityButton);
+
     //==========================================================================
     // Clip Type — detented rotary knob
     setupLabel (clipTypeLabel, "CIRCUIT");
     clipTypeAttach = std::make_unique<SliderAttachment> (p.apvts, ParamIDs::clipType, clipTypeKnob);
 
     //==========================================================================
-    // Fixed 700x500 window — no resize handle
-    setResizable (false, false);
-    setSize (700, 500);
+    // Transfer curve — follows Circuit, Drive and Sag
+    addAndMakeVisible (transferCurve);
+
+    //==========================================================================
+    // Analyzer — click toggles spectrum / oscilloscope
+    addAndMakeVisible (analyzer);
+
+    //==========================================================================
+    // Meters — publishing starts now and stops in the destructor
+    for (auto* meter : { &inputMeter, &outputMeter, &gainReductionMeter })
+        addAndMakeVisible (meter);
+
+    processor.getMetering().setActive (true);
+    lastMeterFrameMs = juce::Time::getMillisecondCounterHiRes();
+
+   #if CLAYMORE_STAGE_TIMERS
+    //==========================================================================
+    // Stage timing overlay — added last so it sits above every control when shown
+    addChildComponent (timingOverlay);
+   #endif
+
+    //==========================================================================
+    // Zones — fixed in design coordinates (the static layer worker reads them)
+    {
+        auto bounds = juce::Rectangle<int> (designWidth, designHeight);
+
+        const int headerH  = 36;
+        const int footerH  = 34;
+        const int utilityH = 90;
+
+        headerZone  = bounds.removeFromTop    (headerH);
+        footerZone  = bounds.removeFromBottom (footerH);
+        utilityZone = bounds.removeFromBottom (utilityH);
+        primaryZone = bounds; // remainder ~362px
+    }
+
+    //==========================================================================
+    // paint() fills every pixel from the cached static layer
+    setOpaque (true);
+
+    //==========================================================================
+    // Resizable 0.7x - 2.5x of the 700x500 design, aspect ratio locked
+    setResizable (true, true);
+    setResizeLimits (designWidth * 7 / 10, designHeight * 7 / 10,
+                     designWidth * 5 / 2,  designHeight * 5 / 2);
+    getConstrainer()->setFixedAspectRatio ((double) designWidth / (double) designHeight);
+    setSize (designWidth, designHeight);
 }
 
 ClaymoreEditor::~ClaymoreEditor()
 {
+    staticLayer.stop();
+    processor.getMetering().setActive (false);
     gateEnabledButton.removeMouseListener (this);
 
     // CRITICAL: Clear LookAndFeel pointer before theme member is destroyed.
@@ -109,6 +168,15 @@ ClaymoreEditor::~ClaymoreEditor()
 
 //==============================================================================
 void ClaymoreEditor::paint (juce::Graphics& g)
+{
+    // The whole panel behind the controls is static: it is rasterised once per raster scale
+    // (UI scale x display scale, so it stays sharp on HiDPI) and blitted on every repaint.
+    // While a resize is re-rendering it on the worker, the previous raster is stretched.
+    const auto rasterScale = g.getInternalContext().getPhysicalPixelScaleFactor() * getUiScale();
+    g.drawImage (staticLayer.getLayer (rasterScale), getLocalBounds().toFloat());
+}
+
+void ClaymoreEditor::paintStaticLayer (juce::Graphics& g)
 {
     // 1. Background fill — warm light gray (powder-coat matte)
     g.fillAll (juce::Colour (ClaymoreColors::background));
@@ -124,7 +192,7 @@ void ClaymoreEditor::paint (juce::Graphics& g)
     if (grain.isValid())
     {
         g.setTiledImageFill (grain, 0, 0, 1.0f);
-        g.fillRect (getLocalBounds());
+        g.fillRect (juce::Rectangle<int> (designWidth, designHeight));
     }
 
     // 4. Zone separators — beveled edges for machined panel feel
@@ -239,7 +307,7 @@ void ClaymoreEditor::paint (juce::Graphics& g)
 
     // 10. Panel enclosure edge — beveled metal border
     {
-        auto fullBounds = getLocalBounds().toFloat();
+        auto fullBounds = juce::Rectangle<int> (designWidth, designHeight).toFloat();
         g.setColour (juce::Colour (0x30000000));
         g.drawRect (fullBounds, 1.0f);
         g.setColour (juce::Colour (0x10ffffff));
@@ -250,16 +318,8 @@ void ClaymoreEditor::paint (juce::Graphics& g)
 //==============================================================================
 void ClaymoreEditor::resized()
 {
-    auto bounds = getLocalBounds();
-
-    const int headerH  = 36;
-    const int footerH  = 34;
-    const int utilityH = 90;
-
-    headerZone  = bounds.removeFromTop    (headerH);
-    footerZone  = bounds.removeFromBottom (footerH);
-    utilityZone = bounds.removeFromBottom (utilityH);
-    primaryZone = bounds; // remainder ~362px
+    // Layout below is in 700x500 design coordinates; the scale transform at the end maps
+    // it onto the current size.
 
     //==========================================================================
     // Helper: position a rotary knob and its label
@@ -287,6 +347,17 @@ void ClaymoreEditor::resized()
     // Gate enabled toggle
     gateEnabledButton.setBounds (603, pTop + 218, 30, 64);
 
+    // Transfer curve — under the CIRCUIT label
+    transferCurve.setBounds (192, pTop + 130, 56, 48);
+
+    // Analyzer — below the Drive label, between Sag and Threshold
+    analyzer.setBounds (240, pTop + 226, 220, 100);
+
+   #if CLAYMORE_STAGE_TIMERS
+    // Stage timing overlay (hidden by default) — top left of the primary zone
+    timingOverlay.setBounds (8, pTop + 6, 236, StageTimingOverlay::getPreferredHeight());
+   #endif
+
     //==========================================================================
     // Utility Zone — Input | Mix | Output
     {
@@ -295,16 +366,98 @@ void ClaymoreEditor::resized()
         placeKnob (inputGainKnob,  inputGainLabel,  117, uMidY, 48);
         placeKnob (mixKnob,        mixLabel,        350, uMidY, 48);
         placeKnob (outputGainKnob, outputGainLabel, 583, uMidY, 48);
+
+        // Meters — right of the input and output knobs, same height as the knobs
+        inputMeter.setBounds         (151, uMidY - 24, 5, 48);
+        outputMeter.setBounds        (617, uMidY - 24, 5, 48);
+        gainReductionMeter.setBounds (626, uMidY - 24, 5, 48);
     }
 
     //==========================================================================
-    // Header — oversampling ComboBox
+    // Header — oversampling ComboBox, adaptive quality toggle left of its label
     oversamplingBox.setBounds (608, 7, 44, 22);
+    adaptiveQualityButton.setBounds (482, 9, 52, 18);
+
+    //==========================================================================
+    // Proportional scaling — one transform for every laid-out child (the resize corner
+    // and transient popups are positioned in real coordinates and are left alone)
+    const auto uiTransform = juce::AffineTransform::scale (getUiScale());
+
+    for (auto* child : std::initializer_list<juce::Component*> {
+             &driveKnob, &tightnessKnob, &sagKnob, &toneKnob, &presenceKnob,
+             &inputGainKnob, &outputGainKnob, &mixKnob, &gateThresholdKnob, &clipTypeKnob,
+             &driveLabel, &tightnessLabel, &sagLabel, &toneLabel, &presenceLabel,
+             &inputGainLabel, &outputGainLabel, &mixLabel, &gateThresholdLabel, &clipTypeLabel,
+             &gateEnabledButton, &oversamplingBox, &adaptiveQualityButton, &transferCurve, &analyzer,
+             &inputMeter, &outputMeter, &gainReductionMeter })
+        child->setTransform (uiTransform);
+
+   #if CLAYMORE_STAGE_TIMERS
+    timingOverlay.setTransform (uiTransform);
+   #endif
+}
+
+//==============================================================================
+void ClaymoreEditor::updateMeters()
+{
+    // Vblank runs at the display rate; meters only need ~30 Hz
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    if (nowMs - lastMeterFrameMs < meterFrameIntervalMs)
+        return;
+
+    const auto elapsedSeconds = static_cast<float> ((nowMs - lastMeterFrameMs) * 0.001);
+    lastMeterFrameMs = nowMs;
+
+    // Embedded typefaces finished loading after the editor opened: restyle with them
+    if (! fontsApplied && theme.areFontsReady())
+    {
+        fontsApplied = true;
+        staticLayer.invalidate();
+        sendLookAndFeelChange();
+    }
+
+    // No frames (transport stopped, bypassed): readings are silence and meters fall
+    const auto reading = processor.getMetering().read();
+   #if CLAYMORE_STAGE_TIMERS
+    timingOverlay.update();
+   #endif
+    processor.flushGateSettings();
+
+    inputMeter.update         (reading.inputPeak,   reading.inputRms,    elapsedSeconds);
+    outputMeter.update        (reading.outputPeak,  reading.outputRms,   elapsedSeconds);
+    gainReductionMeter.update (reading.limiterGain, reading.limiterGain, elapsedSeconds);
+
+    // Gate LED follows the gate itself (lit = passing signal), not just the toggle
+    const bool gateOpen = reading.gateGain > 0.5f;
+    if (gateOpen != gateLedOpen)
+    {
+        gateLedOpen = gateOpen;
+        gateEnabledButton.getProperties().set ("gateOpen", gateOpen);
+        gateEnabledButton.repaint();
+    }
+
+    // Adaptive quality: name the running rate while the governor is below the selection
+    const int selectedIndex = oversamplingBox.getSelectedItemIndex();
+    const int runningIndex  = adaptiveQualityButton.getToggleState() ? processor.getActiveOversamplingIndex()
+                                                                     : selectedIndex;
+    const auto qualityText  = runningIndex < selectedIndex ? "AUTO " + juce::String (2 << runningIndex) + "x"
+                                                           : juce::String ("AUTO");
+    if (adaptiveQualityButton.getButtonText() != qualityText)
+        adaptiveQualityButton.setButtonText (qualityText);
 }
 
 //==============================================================================
 void ClaymoreEditor::mouseDown (const juce::MouseEvent& e)
 {
+   #if CLAYMORE_STAGE_TIMERS
+    // Hidden stage timing overlay: Shift + Alt click on the panel itself
+    if (e.originalComponent == this && e.mods.isShiftDown() && e.mods.isAltDown())
+    {
+        timingOverlay.setVisible (! timingOverlay.isVisible());
+        return;
+    }
+   #endif
+
     if (e.originalComponent == &gateEnabledButton && e.mods.isPopupMenu())
     {
         // Status header
@@ -391,6 +544,13 @@ void ClaymoreEditor::mouseDown (const juce::MouseEvent& e)
             menu.addSubMenu ("Range", sub);
         }
 
+        // Lookahead toggle — detector runs ahead by the oversampling latency
+        {
+            const bool lookahead = processor.getGateLookahead();
+            menu.addItem ("Lookahead", true, lookahead,
+                [this, lookahead] { processor.setGateLookahead (! lookahead); });
+        }
+
         menu.addSeparator();
 
         // Reset All Defaults
@@ -401,6 +561,7 @@ void ClaymoreEditor::mouseDown (const juce::MouseEvent& e)
             processor.setGateHysteresis (4.0f);
             processor.setGateSidechainHPF (150.0f);
             processor.setGateRange (-60.0f);
+            processor.setGateLookahead (false);
             gateThresholdKnob.setValue (gateThresholdKnob.getDoubleClickReturnValue(), juce::sendNotification);
         });
 
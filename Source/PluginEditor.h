@@ -3,15 +3,32 @@
 #include <juce_audio_utils/juce_audio_utils.h>
 #include "PluginProcessor.h"
 #include "look/ClaymoreTheme.h"
+#include "gui/LevelMeter.h"
+#include "gui/SpectrumAnalyzer.h"
+#include "gui/StaticLayerRenderer.h"
+#include "gui/TransferCurveDisplay.h"
+
+#if CLAYMORE_STAGE_TIMERS
+ #include "gui/StageTimingOverlay.h"
+#endif
 
 /**
  * ClaymoreEditor — full pedal-style GUI with Cairn 4-zone layout.
  *
- * Cairn layout (700 x 500px fixed):
- *   - Header  (36px):   CLAYMORE title + OVERSAMPLING ComboBox + LED bypass indicator
+ * Cairn layout (700 x 500px design size, resizable with fixed aspect ratio):
+ *   - Header  (36px):   CLAYMORE title + AUTO (adaptive quality) toggle + OVERSAMPLING
+ *                       ComboBox + LED bypass indicator
  *   - Primary (~362px): Drive hero knob (110px) + 9 satellite knobs with labels
- *   - Utility (80px):   Input Gain, Mix, Output Gain knobs
+ *                       + spectrum analyzer / scope below Drive (runs only while open)
+ *                       + transfer curve below the CIRCUIT knob
+ *   - Utility (80px):   Input Gain, Mix, Output Gain knobs + input/output/GR meters
  *   - Footer  (34px):   Cairn logo + "CAIRN" text + version string (painted only)
+ *   - Hidden:           stage timing overlay over the primary zone (Shift + Alt click,
+ *                       CLAYMORE_STAGE_TIMERS builds only)
+ *
+ * Scaling: layout and painting stay in design coordinates; resized() gives every child
+ * one uniform scale transform, so vectors and the per-scale caches (static panel raster,
+ * knob filmstrips) are rendered at the real physical pixel density.
  *
  * Destruction order:
  *   Attachments MUST be declared AFTER their corresponding sliders (C++ member
@@ -29,6 +46,19 @@ public:
     void mouseDown (const juce::MouseEvent& e) override;
 
 private:
+    // Vblank callback: drains Metering at ~30 Hz and updates meters + gate LED
+    void updateMeters();
+
+    // Background, grain, bevels, title, header LED, footer — in design coordinates,
+    // rasterised per scale by staticLayer (runs on its worker thread)
+    void paintStaticLayer (juce::Graphics& g);
+
+    // Current size relative to the 700x500 design layout
+    float getUiScale() const { return (float) getWidth() / (float) designWidth; }
+
+    static constexpr int designWidth  = 700;
+    static constexpr int designHeight = 500;
+
     //===========================================================================
     // 1. Processor reference
     ClaymoreProcessor& processor;
@@ -36,7 +66,7 @@ private:
     // 2. LookAndFeel — same lifetime as editor (set/cleared explicitly in ctor/dtor)
     ClaymoreTheme theme;
 
-    // 3. Zone rectangles — computed in resized(), read in paint()
+    // 3. Zone rectangles — design coordinates, set once in the constructor
     juce::Rectangle<int> headerZone;
     juce::Rectangle<int> primaryZone;
     juce::Rectangle<int> utilityZone;
@@ -94,10 +124,41 @@ private:
     using ComboBoxAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
     std::unique_ptr<ComboBoxAttachment> oversamplingAttach;
 
+    // Adaptive quality toggle — reads "AUTO 4x" while the governor runs below the selection
+    juce::TextButton adaptiveQualityButton;
+    std::unique_ptr<ButtonAttachment> adaptiveQualityAttach;
+
     // 10. Clip Type — detented rotary knob (primary zone)
     juce::Slider clipTypeKnob;
     juce::Label  clipTypeLabel;
     std::unique_ptr<SliderAttachment> clipTypeAttach;
 
+    // 11. Analyzer — owns its analysis thread; constructing it starts the feed
+    SpectrumAnalyzer analyzer { processor.getAnalyzerFeed() };
+
+    // 12. Transfer curve of the current circuit / drive / sag (cached, worker-computed)
+    TransferCurveDisplay transferCurve { processor.apvts };
+
+    // 13. Meters — fed by the vblank callback (declared last: callback uses everything above)
+    LevelMeter inputMeter;
+    LevelMeter outputMeter;
+    LevelMeter gainReductionMeter { LevelMeter::Style::gainReduction };
+    bool   gateLedOpen      = false;
+    double lastMeterFrameMs = 0.0;
+    bool   fontsApplied     = theme.areFontsReady();   // else restyled when they load
+
+   #if CLAYMORE_STAGE_TIMERS
+    // 14. Stage timing overlay — hidden until toggled; fed by the same vblank callback
+    StageTimingOverlay timingOverlay { processor.getStageTimers() };
+   #endif
+
+    static constexpr double meterFrameIntervalMs = 1000.0 / 30.0;
+    juce::VBlankAttachment meterVBlank { this, [this] { updateMeters(); } };
+
+    // 15. Static panel raster per scale — stopped first in the destructor (its worker
+    //     reads the zones and theme)
+    StaticLayerRenderer staticLayer { *this, designWidth, designHeight,
+                                      [this] (juce::Graphics& g) { paintStaticLayer (g); } };
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ClaymoreEditor)
 };
@@ -9,26 +9,20 @@ ClaymoreProcessor::ClaymoreProcessor()
                         .withOutput ("Output", juce::AudioChannelSet::stereo(), true)),
       apvts (*this, nullptr, "ClaymoreParameters", createParameterLayout())
 {
-    // Cache all 11 raw parameter pointers for real-time safe reads in processBlock.
-    // Must be done in constructor so pointers are valid immediately.
-
-    // Distortion
-    driveParam     = apvts.getRawParameterValue (ParamIDs::drive);
-    clipTypeParam  = apvts.getRawParameterValue (ParamIDs::clipType);
-    tightnessParam = apvts.getRawParameterValue (ParamIDs::tightness);
-    sagParam       = apvts.getRawParameterValue (ParamIDs::sag);
-    toneParam      = apvts.getRawParameterValue (ParamIDs::tone);
-    presenceParam  = apvts.getRawParameterValue (ParamIDs::presence);
-
-    // Signal chain
-    inputGainParam     = apvts.getRawParameterValue (ParamIDs::inputGain);
-    outputGainParam    = apvts.getRawParameterValue (ParamIDs::outputGain);
-    mixParam           = apvts.getRawParameterValue (ParamIDs::mix);
-    gateEnabledParam   = apvts.getRawParameterValue (ParamIDs::gateEnabled);
-    gateThresholdParam = apvts.getRawParameterValue (ParamIDs::gateThreshold);
-
-    // Quality
-    oversamplingParam  = apvts.getRawParameterValue (ParamIDs::oversampling);
+    // Parameter pointers and listeners live in ParameterSnapshotSource (member `parameters`)
+
+    // Editor-side copy of the hidden gate settings starts at the engine defaults
+    gateSettings = { engine.getGateAttack(),  engine.getGateRelease(),
+                     engine.getGateHysteresis(), engine.getGateRange(),
+                     engine.getGateSidechainHPF(), engine.getGateLookahead() };
+
+   #if CLAYMORE_STAGE_CLOCK
+    engine.setStageClock (&stageClock);
+   #endif
+
+   #if CLAYMORE_TRACE
+    trace = AudioTrace::createFromEnvironment();
+   #endif
 }
 
 // =============================================================================
@@ -52,36 +46,51 @@ bool ClaymoreProcessor::isBusesLayoutSupported (const BusesLayout& layouts) cons
 // =============================================================================
 void ClaymoreProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    // Every stage is prepared for one internal tile, not the host block: processBlock()
+    // splits host blocks of any size into tiles of at most maxTileSize samples
+    tileSize = juce::jlimit (1, maxTileSize, samplesPerBlock);
+
     juce::dsp::ProcessSpec spec;
     spec.sampleRate       = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32> (samplesPerBlock);
+    spec.maximumBlockSize = static_cast<juce::uint32> (tileSize);
     spec.numChannels      = static_cast<juce::uint32> (getTotalNumOutputChannels());
 
-    // Prepare ClaymoreEngine (oversampling + fuzz DSP)
+    // Fresh snapshot of every parameter (the audio thread is not running here)
+    parameters.invalidate();
+    parameters.update();
+    const auto& snapshot = parameters.get();
+
+    // Prepare ClaymoreEngine (oversampling + fuzz DSP), with any gate settings changed
+    // while playback was stopped (the audio thread is not draining the queue here)
+    gateCommands.drain ([this] (const auto& command) { applyGateCommand (command); });
     engine.prepare (spec);
 
     // Apply the saved oversampling index before reporting latency (QUAL-01, QUAL-02)
-    const int initialOsIndex = static_cast<int> (oversamplingParam->load (std::memory_order_relaxed));
-    if (initialOsIndex != 0)
-        engine.setOversamplingFactor (initialOsIndex);
-    lastOversamplingIndex = initialOsIndex;
-
-    // Prepare output limiter
+    // Hard switch here — nothing is playing yet, so there is nothing to crossfade.
+    // The adaptive quality governor restarts at full quality.
+    qualityGovernor.prepare (sampleRate);
+    engine.setLatencyReference (snapshot.adaptiveQuality ? snapshot.oversamplingIndex : -1);
+    engine.setOversamplingFactor (snapshot.oversamplingIndex, ClaymoreEngine::OversamplingSwitch::immediate);
+    activeOversamplingIndex.store (snapshot.oversamplingIndex, std::memory_order_relaxed);
+
+    // Prepare output limiter (its lookahead adds to the reported latency below)
     outputLimiter.prepare (spec);
 
+    analyzerFeed.setSampleRate (sampleRate);
+
     // Prepare dry/wet mixer — set wet latency to oversampling latency
     dryWetMixer.prepare (spec);
     dryWetMixer.setMixingRule (juce::dsp::DryWetMixingRule::linear);
-    dryWetMixer.setWetLatency (engine.getLatencyInSamples());
+    lastReportedLatency = engine.getLatencyInSamples();
+    lastWetLatency      = engine.getOutputLatencyInSamples();
+    dryWetMixer.setWetLatency (lastWetLatency);
 
     // Report oversampling latency to DAW for session-level compensation (Pitfall 2: std::round)
-    setLatencySamples (static_cast<int> (std::round (engine.getLatencyInSamples())));
+    setLatencySamples (static_cast<int> (std::round (lastReportedLatency)) + outputLimiter.getLatencyInSamples());
 
     // Prepare gain smoothers (5ms ramp at current sample rate)
-    const float initialInputGainLinear  = juce::Decibels::decibelsToGain (
-        inputGainParam->load  (std::memory_order_relaxed));
-    const float initialOutputGainLinear = juce::Decibels::decibelsToGain (
-        outputGainParam->load (std::memory_order_relaxed));
+    const float initialInputGainLinear  = juce::Decibels::decibelsToGain (snapshot.inputGainDB);
+    const float initialOutputGainLinear = juce::Decibels::decibelsToGain (snapshot.outputGainDB);
 
     inputGainSmoother.reset  (sampleRate, 0.005);
     inputGainSmoother.setCurrentAndTargetValue (initialInputGainLinear);
@@ -89,6 +98,10 @@ void ClaymoreProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     outputGainSmoother.reset (sampleRate, 0.005);
     outputGainSmoother.setCurrentAndTargetValue (initialOutputGainLinear);
 
+    // Engine parameters (engine.prepare() cleared its applied state: every field is pushed),
+    // mix proportion and limiter mode
+    applySnapshot (snapshot);
+
     // Signal that processBlock can run safely
     isInitialized.store (true, std::memory_order_release);
 }
@@ -115,6 +128,15 @@ void ClaymoreProcessor::processBlock (juce::AudioBuffer<float>& buffer,
         return;
     }
 
+    // --- Adaptive quality: the governor is fed this callback's wall-clock time ---
+    const auto callbackStartTicks = juce::Time::getHighResolutionTicks();
+
+    // --- Stage timers (overlay open) / trace capture (CLAYMORE_TRACE): the whole callback ---
+    const bool stageTimingThisBlock = stageTimers.isActive();
+    if (stageTimingThisBlock)
+        stageFrame = {};
+    stageClock.start (stageTimingThisBlock ? &stageFrame : nullptr, trace.get());
+
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -122,87 +144,219 @@ void ClaymoreProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    // --- Read all parameters (atomic loads, no string lookups) ---
-    const float drive         = driveParam->load     (std::memory_order_relaxed);
-    const int   clipType      = static_cast<int> (clipTypeParam->load (std::memory_order_relaxed));
-    const float tightness     = tightnessParam->load  (std::memory_order_relaxed);
-    const float sag           = sagParam->load        (std::memory_order_relaxed);
-    const float tone          = toneParam->load       (std::memory_order_relaxed);
-    const float presence      = presenceParam->load   (std::memory_order_relaxed);
-    const float inputGainDB   = inputGainParam->load  (std::memory_order_relaxed);
-    const float outputGainDB  = outputGainParam->load (std::memory_order_relaxed);
-    const float mix           = mixParam->load        (std::memory_order_relaxed);
-    const bool  gateOn        = gateEnabledParam->load (std::memory_order_relaxed) >= 0.5f;
-    const float gateThreshDB  = gateThresholdParam->load (std::memory_order_relaxed);
-
-    // --- Oversampling rate change detection (QUAL-01, QUAL-02) ---
-    {
-        const int newOversamplingIndex = static_cast<int> (oversamplingParam->load (std::memory_order_relaxed));
-        if (newOversamplingIndex != lastOversamplingIndex)
+    // --- Hidden gate settings from the editor, applied at the block boundary ---
+    gateCommands.drain ([this] (const auto& command) { applyGateCommand (command); });
+
+    // --- Parameters: one atomic load when nothing changed; rebuild + apply otherwise ---
+    if (parameters.update())
+    {
+        applySnapshot (parameters.get());
+        stageClock.mark ("parameters");
+    }
+
+    // --- Oversampling rate change (QUAL-01, QUAL-02) ---
+    // Requested every block: the engine early-outs when nothing changed and coalesces
+    // requests that arrive while a crossfade is still running. With Adaptive Quality on,
+    // the governor's tier lowers the running rate below the selected one and the selected
+    // rate is the engine's latency reference; off, there is no reference (no padding).
+    // Turning it off while stepped down keeps the reference until the engine has
+    // committed back to the selected rate, so the host latency does not dip and return.
+    const bool adaptiveQuality = parameters.get().adaptiveQuality;
+    {
+        const int selectedIndex = parameters.get().oversamplingIndex;
+
+        if (adaptiveQuality)
+            qualityGovernor.setMaxTier (selectedIndex);
+        else
+            qualityGovernor.reset();
+
+        const bool returningToSelected = engine.getLatencyReference() >= 0
+                                      && (engine.isOversamplingTransitionActive()
+                                          || engine.getOversamplingIndex() != selectedIndex);
+
+        engine.setLatencyReference (adaptiveQuality || returningToSelected ? selectedIndex : -1);
+        engine.setOversamplingFactor (selectedIndex - qualityGovernor.getTier());
+        activeOversamplingIndex.store (engine.getOversamplingIndex(), std::memory_order_relaxed);
+
+        // Host: the committed rate's latency. Dry path: the wet output's actual timing,
+        // which moves to the aligned latency during a crossfade and follows pad glides
+        const float newLatency = engine.getLatencyInSamples();
+        if (newLatency != lastReportedLatency)
         {
-            lastOversamplingIndex = newOversamplingIndex;
-            engine.setOversamplingFactor (newOversamplingIndex);
+            lastReportedLatency = newLatency;
+            setLatencySamples (static_cast<int> (std::round (newLatency)) + outputLimiter.getLatencyInSamples());
+        }
 
-            const float newLatency = engine.getLatencyInSamples();
-            dryWetMixer.setWetLatency (newLatency);
-            setLatencySamples (static_cast<int> (std::round (newLatency)));
+        const float wetLatency = engine.getOutputLatencyInSamples();
+        if (wetLatency != lastWetLatency)
+        {
+            lastWetLatency = wetLatency;
+            dryWetMixer.setWetLatency (wetLatency);
         }
     }
 
-    // --- 1. Input Gain (pre-distortion level trim) ---
-    {
-        inputGainSmoother.setTargetValue (juce::Decibels::decibelsToGain (inputGainDB));
-        const int numSamples   = buffer.getNumSamples();
-        const int numChannels  = buffer.getNumChannels();
+    // --- Metering: tiles accumulate into one frame, published after the block ---
+    meteringThisBlock = metering.isActive();
+    if (meteringThisBlock)
+        meterFrame = {};
+
+    analyzerThisBlock = analyzerFeed.isActive();
 
-        for (int s = 0; s < numSamples; ++s)
+    // --- Small blocks (the common live-tracking case) fit in one tile: no view set-up ---
+    const int numSamples = buffer.getNumSamples();
+    if (numSamples <= tileSize)
+    {
+        processTile (buffer);
+    }
+    else
+    {
+        // --- Internal tiling: every stage runs tile by tile so the oversampled working set
+        //     stays in L1/L2, and host blocks larger than promised are handled safely ---
+        for (int start = 0; start < numSamples; start += tileSize)
         {
-            const float gain = inputGainSmoother.getNextValue();
-            for (int ch = 0; ch < numChannels; ++ch)
-                buffer.setSample (ch, s, buffer.getSample (ch, s) * gain);
+            tileView.setDataToReferTo (buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                       start, juce::jmin (tileSize, numSamples - start));
+            processTile (tileView);
         }
     }
 
+    if (meteringThisBlock)
+    {
+        meterFrame.gateGain  = engine.getGateGain();
+        meterFrame.numValues = numSamples * buffer.getNumChannels();
+        metering.push (meterFrame);
+    }
+
+    if (adaptiveQuality
+        && qualityGovernor.addBlock (juce::Time::getHighResolutionTicks() - callbackStartTicks, numSamples))
+    {
+        stageClock.mark ("quality tier", "tier", qualityGovernor.getTier(), "load", qualityGovernor.getLastLoad());
+    }
+
+    stageClock.stop (numSamples, getSampleRate());
+    if (stageTimingThisBlock)
+        stageTimers.push (stageFrame);
+}
+
+// =============================================================================
+// Pushes a rebuilt snapshot into every stage. The engine diffs its own fields; the
+// smoother, mixer and limiter setters are cheap no-ops when their value is unchanged.
+void ClaymoreProcessor::applySnapshot (const ParameterSnapshot& snapshot)
+{
+    engine.applyParameters (snapshot.engine);
+
+    // Targets only — the smoothers ramp across tiles
+    inputGainSmoother.setTargetValue  (juce::Decibels::decibelsToGain (snapshot.inputGainDB));
+    outputGainSmoother.setTargetValue (juce::Decibels::decibelsToGain (snapshot.outputGainDB));
+    dryWetMixer.setWetMixProportion (snapshot.mix);
+
+    outputLimiter.setTruePeak (snapshot.limiterTruePeak);
+}
+
+// =============================================================================
+// Audio-thread side of the gate settings queue: the engine setters (and any coefficient
+// recomputation they do) only ever run here
+void ClaymoreProcessor::applyGateCommand (const GateCommandQueue::Command& command)
+{
+    using Setting = GateCommandQueue::Setting;
+
+    stageClock.mark ("gate setting", "setting", static_cast<double> (command.setting), "value", command.value);
+
+    switch (command.setting)
+    {
+        case Setting::attack:       engine.setGateAttack       (command.value); break;
+        case Setting::release:      engine.setGateRelease      (command.value); break;
+        case Setting::hysteresis:   engine.setGateHysteresis   (command.value); break;
+        case Setting::range:        engine.setGateRange        (command.value); break;
+        case Setting::sidechainHPF: engine.setGateSidechainHPF (command.value); break;
+        case Setting::lookahead:    engine.setGateLookahead    (command.value >= 0.5f); break;
+    }
+}
+
+// =============================================================================
+// Gain stage: per-sample only while the smoother ramps; one vector multiply when
+// settled, nothing at all at unity (the default for both trims)
+void ClaymoreProcessor::applySmoothedGain (juce::AudioBuffer<float>& tile,
+                                           juce::SmoothedValue<float>& gainSmoother)
+{
+    if (! gainSmoother.isSmoothing())
+    {
+        const float gain = gainSmoother.getTargetValue();
+        if (gain != 1.0f)
+            tile.applyGain (gain);
+        return;
+    }
+
+    const int numSamples  = tile.getNumSamples();
+    const int numChannels = tile.getNumChannels();
+
+    for (int s = 0; s < numSamples; ++s)
+    {
+        const float gain = gainSmoother.getNextValue();
+        for (int ch = 0; ch < numChannels; ++ch)
+            tile.setSample (ch, s, tile.getSample (ch, s) * gain);
+    }
+}
+
+// =============================================================================
+void ClaymoreProcessor::processTile (juce::AudioBuffer<float>& tile)
+{
+    // Stage laps below; tiling, meters and analyzer taps are skipped (counted as "other")
+    stageClock.skip();
+
+    // --- 1. Input Gain (pre-distortion level trim) ---
+    applySmoothedGain (tile, inputGainSmoother);
+    stageClock.lap (StageTimers::Stage::input);
+
+    if (meteringThisBlock)
+    {
+        Metering::accumulate (tile, meterFrame.inputPeak, meterFrame.inputSumSquares);
+        stageClock.skip();
+    }
+
     // --- 2. Capture dry signal for latency-compensated mix ---
     {
-        dryWetMixer.setWetMixProportion (mix);
-        juce::dsp::AudioBlock<float> inputBlock (buffer);
+        juce::dsp::AudioBlock<float> inputBlock (tile);
         dryWetMixer.pushDrySamples (inputBlock);
     }
+    stageClock.lap (StageTimers::Stage::mix);
 
     // --- 3. ClaymoreEngine: noise gate → oversample → fuzz → tone ---
-    engine.setDrive         (drive);
-    engine.setClipType      (clipType);
-    engine.setTightness     (tightness);
-    engine.setSag           (sag);
-    engine.setTone          (tone);
-    engine.setPresence      (presence);
-    engine.setGateEnabled   (gateOn);
-    engine.setGateThreshold (gateThreshDB);
-    engine.process          (buffer);
+    if (analyzerThisBlock)
+    {
+        analyzerFeed.push (AnalyzerFeed::Stream::pre, tile);
+        stageClock.skip();
+    }
+
+    engine.process (tile);
+
+    if (analyzerThisBlock)
+    {
+        analyzerFeed.push (AnalyzerFeed::Stream::post, tile);
+        stageClock.skip();
+    }
 
     // --- 4. Blend wet and latency-compensated dry ---
     {
-        juce::dsp::AudioBlock<float> wetBlock (buffer);
+        juce::dsp::AudioBlock<float> wetBlock (tile);
         dryWetMixer.mixWetSamples (wetBlock);
     }
+    stageClock.lap (StageTimers::Stage::mix);
 
     // --- 5. Output Gain (post-mix level trim) ---
-    {
-        outputGainSmoother.setTargetValue (juce::Decibels::decibelsToGain (outputGainDB));
-        const int numSamples  = buffer.getNumSamples();
-        const int numChannels = buffer.getNumChannels();
-
-        for (int s = 0; s < numSamples; ++s)
-        {
-            const float gain = outputGainSmoother.getNextValue();
-            for (int ch = 0; ch < numChannels; ++ch)
-                buffer.setSample (ch, s, buffer.getSample (ch, s) * gain);
-        }
-    }
+    applySmoothedGain (tile, outputGainSmoother);
+    stageClock.lap (StageTimers::Stage::outputGain);
 
     // --- 6. Brickwall limiter (last in chain, SIG-04) ---
-    outputLimiter.process (buffer);
+    outputLimiter.process (tile);
+    stageClock.lap (StageTimers::Stage::limiter);
+
+    // --- 7. Meters (editor open only) ---
+    if (meteringThisBlock)
+    {
+        Metering::accumulate (tile, meterFrame.outputPeak, meterFrame.outputSumSquares);
+        meterFrame.limiterGain = juce::jmin (meterFrame.limiterGain, outputLimiter.getLowestGainInLastBlock());
+    }
 }
 
 // =============================================================================
@@ -5,23 +5,35 @@
 #include <juce_dsp/juce_dsp.h>
 
 #include "Parameters.h"
+#include "ParameterSnapshot.h"
+#include "GateCommandQueue.h"
+#include "Metering.h"
+#include "AnalyzerFeed.h"
 #include "dsp/ClaymoreEngine.h"
 #include "dsp/OutputLimiter.h"
+#include "dsp/QualityGovernor.h"
+#include "dsp/StageTimers.h"
 
 /**
  * ClaymoreProcessor — main AudioProcessor subclass.
  *
- * Signal chain (processBlock):
+ * Signal chain (processBlock → processTile, per internal tile of ≤ maxTileSize samples):
  *   isInitialized guard
  *   → Input Gain (SmoothedValue, multiplicative)
  *   → DryWetMixer::pushDrySamples() (capture dry with latency compensation)
  *   → ClaymoreEngine::process() [gate → oversample → fuzz → tone]
  *   → DryWetMixer::mixWetSamples() (blend with latency-compensated dry)
  *   → Output Gain (SmoothedValue, multiplicative)
- *   → OutputLimiter::process() (brickwall, last in chain)
+ *   → OutputLimiter::process() (lookahead brickwall, last in chain)
+ *   → Metering (input after input gain, output after the limiter; editor open only)
+ *   AnalyzerFeed taps the engine input and output (analyzer open only)
+ *   StageTimers laps every stage above (CLAYMORE_STAGE_TIMERS builds, overlay open only)
+ *   AudioTrace records the same laps, parameter changes and rate switches (CLAYMORE_TRACE)
+ *   QualityGovernor times the whole callback (Adaptive Quality on) and picks the rate
  *
- * All 11 APVTS parameters cached as std::atomic<float>* in prepareToPlay()
- * for real-time safe access in processBlock (no string lookups at runtime).
+ * All 14 APVTS parameters reach the audio thread through ParameterSnapshotSource:
+ * processBlock re-reads them only when one changed, and pushes the changed ones into
+ * the engine, gain smoothers, mixer and limiter (no string lookups at runtime).
  */
 class ClaymoreProcessor final : public juce::AudioProcessor
 {
@@ -63,42 +75,107 @@ public:
     // APVTS (public — editor reads it directly)
     juce::AudioProcessorValueTreeState apvts;
 
-    // Gate advanced settings (forwarded to ClaymoreEngine)
-    float getGateAttack()       const { return engine.getGateAttack(); }
-    float getGateRelease()      const { return engine.getGateRelease(); }
-    float getGateHysteresis()   const { return engine.getGateHysteresis(); }
-    float getGateRange()        const { return engine.getGateRange(); }
-    float getGateSidechainHPF() const { return engine.getGateSidechainHPF(); }
-    void  setGateAttack       (float v) { engine.setGateAttack (v); }
-    void  setGateRelease      (float v) { engine.setGateRelease (v); }
-    void  setGateHysteresis   (float v) { engine.setGateHysteresis (v); }
-    void  setGateRange        (float v) { engine.setGateRange (v); }
-    void  setGateSidechainHPF (float v) { engine.setGateSidechainHPF (v); }
+    // Gate advanced settings (message thread). Getters read the editor-side copy;
+    // setters clamp it to the engine's ranges and queue the change for the audio thread
+    // (GateCommandQueue, which holds back and resends what a full queue turned away).
+    float getGateAttack()       const { return gateSettings.attack; }
+    float getGateRelease()      const { return gateSettings.release; }
+    float getGateHysteresis()   const { return gateSettings.hysteresis; }
+    float getGateRange()        const { return gateSettings.range; }
+    float getGateSidechainHPF() const { return gateSettings.sidechainHPF; }
+    bool  getGateLookahead()    const { return gateSettings.lookahead; }
+    void  setGateAttack       (float v) { gateSettings.attack       = ClaymoreEngine::limitGateAttack (v);       gateCommands.push (GateCommandQueue::Setting::attack, gateSettings.attack); }
+    void  setGateRelease      (float v) { gateSettings.release      = ClaymoreEngine::limitGateRelease (v);      gateCommands.push (GateCommandQueue::Setting::release, gateSettings.release); }
+    void  setGateHysteresis   (float v) { gateSettings.hysteresis   = ClaymoreEngine::limitGateHysteresis (v);   gateCommands.push (GateCommandQueue::Setting::hysteresis, gateSettings.hysteresis); }
+    void  setGateRange        (float v) { gateSettings.range        = ClaymoreEngine::limitGateRange (v);        gateCommands.push (GateCommandQueue::Setting::range, gateSettings.range); }
+    void  setGateSidechainHPF (float v) { gateSettings.sidechainHPF = ClaymoreEngine::limitGateSidechainHPF (v); gateCommands.push (GateCommandQueue::Setting::sidechainHPF, gateSettings.sidechainHPF); }
+    void  setGateLookahead    (bool v)  { gateSettings.lookahead    = v; gateCommands.push (GateCommandQueue::Setting::lookahead, v ? 1.0f : 0.0f); }
+
+    /** Resends gate changes a full queue held back (message thread; the editor's frame timer). */
+    void  flushGateSettings() { gateCommands.flush(); }
+
+    // Meter data for the editor (lock-free; published only while the editor is active)
+    Metering& getMetering() { return metering; }
+
+    // Pre/post-distortion samples for the editor's analyzer (copied only while it is open)
+    AnalyzerFeed& getAnalyzerFeed() { return analyzerFeed; }
+
+   #if CLAYMORE_STAGE_TIMERS
+    // Per-stage callback timing for the editor's hidden overlay
+    StageTimers& getStageTimers() { return stageTimers; }
+   #endif
+
+    // Oversampling index the engine is running — below the selected one while the
+    // adaptive quality governor has stepped down (any thread)
+    int getActiveOversamplingIndex() const { return activeOversamplingIndex.load (std::memory_order_relaxed); }
 
 private:
+    // Runs the full chain on one internal tile (a view into the host buffer)
+    void processTile (juce::AudioBuffer<float>& tile);
+    void applySnapshot (const ParameterSnapshot& snapshot);
+    void applyGateCommand (const GateCommandQueue::Command& command);
+    static void applySmoothedGain (juce::AudioBuffer<float>& tile, juce::SmoothedValue<float>& gainSmoother);
+
+    // Internal tiling: 128 samples keeps the 8x oversampled working set at 1024 samples
+    // (4 KB) per channel, so data stays in L1 between stages
+    static constexpr int maxTileSize = 128;
+    int tileSize = maxTileSize;
+    juce::AudioBuffer<float> tileView;   // non-owning view, re-pointed per tile (no allocation)
+
     // Initialization guard: some hosts call processBlock before prepareToPlay
     std::atomic<bool> isInitialized { false };
 
-    // Oversampling rate-change tracking (QUAL-01)
-    // Compared per-block against oversamplingParam to detect user rate changes
-    int lastOversamplingIndex = 0;
-
-    // Cached atomic parameter pointers — set in prepareToPlay, read in processBlock
-    // Distortion
-    std::atomic<float>* driveParam    = nullptr;
-    std::atomic<float>* clipTypeParam = nullptr;
-    std::atomic<float>* tightnessParam= nullptr;
-    std::atomic<float>* sagParam      = nullptr;
-    std::atomic<float>* toneParam     = nullptr;
-    std::atomic<float>* presenceParam = nullptr;
-    // Signal chain
-    std::atomic<float>* inputGainParam     = nullptr;
-    std::atomic<float>* outputGainParam    = nullptr;
-    std::atomic<float>* mixParam           = nullptr;
-    std::atomic<float>* gateEnabledParam   = nullptr;
-    std::atomic<float>* gateThresholdParam = nullptr;
-    // Quality
-    std::atomic<float>* oversamplingParam  = nullptr;
+    // Oversampling latency tracking (QUAL-01) — engine latency only; the host additionally
+    // gets the limiter lookahead (OutputLimiter::getLatencyInSamples(), fixed per prepare)
+    // The engine may start a (coalesced) rate switch on any block; latency is re-reported
+    // to the host only when the committed value changes. The dry/wet mixer follows the
+    // wet output's actual latency (ClaymoreEngine::getOutputLatencyInSamples()) instead,
+    // which differs from it during crossfades and pad glides
+    float lastReportedLatency = 0.0f;
+    float lastWetLatency      = 0.0f;
+
+    // Adaptive quality (opt-in): lowers the running rate under sustained callback load.
+    // While it is on, the engine's latency reference stays on the selected rate, so the
+    // governor's tier changes never move the reported latency.
+    QualityGovernor  qualityGovernor;
+    std::atomic<int> activeOversamplingIndex { 0 };
+
+    // Versioned parameter snapshot — rebuilt on the audio thread only when an APVTS
+    // parameter changed (declared after apvts: it registers listeners on it)
+    ParameterSnapshotSource parameters { apvts };
+
+    // Hidden gate settings: editor-side copy (message thread only) + queue to the engine.
+    // The engine's own copies are touched on the audio thread only.
+    struct GateSettings
+    {
+        float attack       = 0.0f;
+        float release      = 0.0f;
+        float hysteresis   = 0.0f;
+        float range        = 0.0f;
+        float sidechainHPF = 0.0f;
+        bool  lookahead    = false;
+    } gateSettings;
+
+    GateCommandQueue gateCommands;
+
+    // Metering: one frame per host block, accumulated across tiles
+    Metering        metering;
+    Metering::Frame meterFrame;
+    bool            meteringThisBlock = false;
+
+    // Analyzer feed: engine input/output, mono-mixed into lock-free rings
+    AnalyzerFeed analyzerFeed;
+    bool         analyzerThisBlock = false;
+
+    // Stage timers: one frame per host block, laps accumulated across tiles (the engine
+    // laps its own stages on the same clock). An empty object without CLAYMORE_STAGE_TIMERS
+    StageTimers        stageTimers;
+    StageTimers::Clock stageClock;
+    StageTimers::Frame stageFrame;
+
+    // Chrome trace capture — created only in CLAYMORE_TRACE builds (see AudioTrace.h for
+    // the CLAYMORE_TRACE_FILE / CLAYMORE_TRACE_SECONDS environment variables)
+    std::unique_ptr<AudioTrace> trace;
 
     // DSP objects
     ClaymoreEngine engine;
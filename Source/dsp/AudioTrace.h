@@ -0,0 +1,235 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <juce_core/juce_core.h>
+
+// Chrome-trace capture of audio-thread activity is a profiling build option (CMake
+// CLAYMORE_TRACE); without it no AudioTrace is ever created.
+#ifndef CLAYMORE_TRACE
+ #define CLAYMORE_TRACE 0
+#endif
+
+/**
+ * AudioTrace — begin/end events from the audio thread, written out as Chrome trace JSON
+ * (load the file in Perfetto or chrome://tracing).
+ *
+ * The audio thread push()es fixed-size Events into a preallocated wait-free SPSC ring
+ * (AbstractFifo); if the ring is full the event is dropped and counted, never waited for.
+ * Names, categories and argument names must be string literals (or other static storage):
+ * only the pointer is recorded. A background thread drains the ring every 50 ms and
+ * appends the events to the file, so a capture costs the audio thread one timestamp and
+ * one slot write per event.
+ *
+ * Events with endTicks > beginTicks become complete ("X") slices, nested per thread by
+ * time; endTicks == beginTicks becomes a thread-scoped instant ("i"). Each audio thread
+ * the host uses gets its own track, so callbacks hopping between threads are visible.
+ * Recording stops by itself after maxSeconds; the file is closed properly on stop or
+ * destruction (and is still loadable if the host dies mid-capture — the trace uses the
+ * JSON array format, whose closing bracket is optional).
+ */
+class AudioTrace : private juce::Thread
+{
+public:
+    struct Event
+    {
+        const char* name       = nullptr;
+        const char* category   = nullptr;
+        juce::int64 beginTicks = 0;
+        juce::int64 endTicks   = 0;          // == beginTicks: instant event
+        std::array<const char*, 2> argNames { nullptr, nullptr };
+        std::array<double, 2>      args     { 0.0, 0.0 };
+        juce::Thread::ThreadID     thread   = nullptr;
+    };
+
+    AudioTrace (const juce::File& fileToWrite, double maxSecondsToRecord)
+        : juce::Thread ("Claymore Trace Writer"),
+          file (fileToWrite.getNonexistentSibling()),
+          maxSeconds (maxSecondsToRecord),
+          originTicks (now())
+    {
+        output = file.createOutputStream();
+        if (output == nullptr)
+            return;
+
+        output->writeText ("[\n", false, false, nullptr);
+        writeMetadata ("process_name", 0, "Claymore");
+        recording.store (true, std::memory_order_release);
+        startThread (juce::Thread::Priority::low);
+    }
+
+    ~AudioTrace() override
+    {
+        stop();
+    }
+
+    /**
+     * Trace for a plugin instance, configured from the environment:
+     *   CLAYMORE_TRACE_FILE     output path (default: Claymore-trace.json in the temp folder;
+     *                           an existing file is never overwritten — a suffix is added)
+     *   CLAYMORE_TRACE_SECONDS  capture length (default 30)
+     */
+    static std::unique_ptr<AudioTrace> createFromEnvironment()
+    {
+        const auto path = juce::SystemStats::getEnvironmentVariable ("CLAYMORE_TRACE_FILE", {});
+        const auto file = path.isNotEmpty() ? juce::File::getCurrentWorkingDirectory().getChildFile (path)
+                                            : juce::File::getSpecialLocation (juce::File::tempDirectory)
+                                                  .getChildFile ("Claymore-trace.json");
+
+        const auto seconds = juce::SystemStats::getEnvironmentVariable ("CLAYMORE_TRACE_SECONDS", "30").getDoubleValue();
+        return std::make_unique<AudioTrace> (file, seconds > 0.0 ? seconds : 30.0);
+    }
+
+    static juce::int64 now() { return juce::Time::getHighResolutionTicks(); }
+
+    // --- Audio thread ---
+
+    /** Records one event. Wait-free; drops (and counts) it if the ring is full or recording ended. */
+    void push (Event event)
+    {
+        if (! recording.load (std::memory_order_acquire))
+            return;
+
+        event.thread = juce::Thread::getCurrentThreadId();
+
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 > 0)
+            events[static_cast<size_t> (scope.startIndex1)] = event;
+        else
+            dropped.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    // --- Any other thread ---
+
+    /** Stops recording, writes what is left and closes the file. Idempotent. */
+    void stop()
+    {
+        recording.store (false, std::memory_order_release);
+        stopThread (2000);
+        finish();
+    }
+
+    const juce::File& getFile() const { return file; }
+
+private:
+    // ~3.6 s of events at 9k events/s (64-sample blocks, every stage) — the writer drains
+    // every 50 ms, so only a stalled disk can fill it
+    static constexpr int capacity = 1 << 15;
+    static constexpr int drainIntervalMs = 50;
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            wait (drainIntervalMs);
+            drain();
+
+            if (juce::Time::highResolutionTicksToSeconds (now() - originTicks) >= maxSeconds)
+            {
+                recording.store (false, std::memory_order_release);
+                drain();
+                break;
+            }
+        }
+    }
+
+    void drain()
+    {
+        const auto scope = fifo.read (fifo.getNumReady());
+        scope.forEach ([this] (int index) { writeEvent (events[static_cast<size_t> (index)]); });
+        output->flush();
+    }
+
+    void finish()
+    {
+        if (output == nullptr)
+            return;
+
+        drain();
+
+        // Summary as a global instant at the end of the capture
+        juce::String summary;
+        summary << separator() << "{\"name\":\"trace end\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":"
+                << juce::String (toMicroseconds (now()), 3)
+                << ",\"args\":{\"dropped events\":" << dropped.load() << "}}\n]\n";
+        output->writeText (summary, false, false, nullptr);
+        output.reset();
+    }
+
+    void writeEvent (const Event& e)
+    {
+        const int track = getTrackId (e.thread);   // may write the track's name first
+
+        juce::String line;
+        line << separator() << "{\"name\":\"" << e.name << "\",\"cat\":\"" << e.category << "\",\"pid\":1,\"tid\":"
+             << track << ",\"ts\":" << juce::String (toMicroseconds (e.beginTicks), 3);
+
+        if (e.endTicks > e.beginTicks)
+            line << ",\"ph\":\"X\",\"dur\":"
+                 << juce::String (1.0e6 * juce::Time::highResolutionTicksToSeconds (e.endTicks - e.beginTicks), 3);
+        else
+            line << ",\"ph\":\"i\",\"s\":\"t\"";
+
+        if (e.argNames[0] != nullptr)
+        {
+            line << ",\"args\":{";
+            for (size_t i = 0; i < e.argNames.size() && e.argNames[i] != nullptr; ++i)
+                line << (i > 0 ? "," : "") << "\"" << e.argNames[i] << "\":" << juce::String (e.args[i], 3);
+            line << "}";
+        }
+
+        line << "}";
+        output->writeText (line, false, false, nullptr);
+    }
+
+    /** Small per-thread track number; names the track on first sight. */
+    int getTrackId (juce::Thread::ThreadID thread)
+    {
+        const auto found = tracks.find (thread);
+        if (found != tracks.end())
+            return found->second;
+
+        const int id = static_cast<int> (tracks.size()) + 1;
+        tracks[thread] = id;
+        writeMetadata ("thread_name", id, "audio thread " + juce::String (id));
+        return id;
+    }
+
+    void writeMetadata (const char* kind, int track, const juce::String& value)
+    {
+        juce::String line;
+        line << separator() << "{\"name\":\"" << kind << "\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track
+             << ",\"args\":{\"name\":\"" << value << "\"}}";
+        output->writeText (line, false, false, nullptr);
+    }
+
+    const char* separator()
+    {
+        const bool first = isFirstEvent;
+        isFirstEvent = false;
+        return first ? "" : ",\n";
+    }
+
+    double toMicroseconds (juce::int64 ticks) const
+    {
+        return 1.0e6 * juce::Time::highResolutionTicksToSeconds (ticks - originTicks);
+    }
+
+    const juce::File  file;
+    const double      maxSeconds;
+    const juce::int64 originTicks;
+
+    // Audio thread → writer
+    juce::AbstractFifo               fifo { capacity };
+    std::unique_ptr<Event[]>         eventStorage { new Event[capacity] };
+    Event*                           events = eventStorage.get();
+    std::atomic<bool>                recording { false };
+    std::atomic<int>                 dropped { 0 };
+
+    // Writer thread only (and finish(), after the writer stopped)
+    std::unique_ptr<juce::FileOutputStream>  output;
+    std::map<juce::Thread::ThreadID, int>    tracks;
+    bool                                     isFirstEvent = true;
+};
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 #include <juce_dsp/juce_dsp.h>
 #include "fuzz/FuzzType.h"
 #include "fuzz/FuzzCore.h"
 #include "fuzz/FuzzTone.h"
+#include "SlidingWindowMax.h"
+#include "StageTimers.h"
 
 /**
  * Main DSP signal chain for Claymore.
@@ -15,6 +19,11 @@
  *
  * Three Oversampling objects are pre-allocated in prepare() (one per rate).
  * setOversamplingFactor() switches between them with zero allocation in process().
+ * Rate changes crossfade between two ShaperLanes (outgoing/incoming factor) over a
+ * short, bounded window so live switching does not produce a discontinuity.
+ * With a latency reference set (setLatencyReference), a rate below the reference is
+ * delay-padded to the reference's latency, so the adaptive quality governor can lower
+ * the rate without the host seeing a latency change.
  *
  * Based on GunkLord FuzzStage.h with Claymore-specific changes:
  * - Tightness HPF extended: 20–800 Hz (was 20–300 Hz, per CONTEXT.md)
@@ -23,8 +32,8 @@
  * - Sag gain-makeup for gain-neutrality (CONTEXT.md requirement)
  *
  * Hidden gate parameters (setGateAttack, setGateRelease, setGateSidechainHPF, setGateRange,
- * setGateHysteresis) are exposed here but not shown in the main UI — Phase 3 will
- * surface them via a right-click context menu.
+ * setGateHysteresis, setGateLookahead) are exposed here but not shown in the main UI —
+ * Phase 3 will surface them via a right-click context menu.
  */
 class ClaymoreEngine
 {
@@ -50,10 +59,20 @@ public:
             oversamplingObjects[i]->initProcessing (static_cast<size_t> (spec.maximumBlockSize));
         }
 
-        // Prepare per-channel fuzz core state at oversampled rate
-        const double oversampledRate = sampleRate * std::pow (2.0, currentOversamplingIndex + 1);
-        for (int ch = 0; ch < maxChannels; ++ch)
-            coreState[ch].prepare (oversampledRate);
+        // Prepare both shaper lanes at the current oversampled rate; only the active one
+        // runs outside of an oversampling crossfade
+        transition = {};
+        for (auto& lane : lanes)
+        {
+            lane.prepareLatencyPad (spec);
+            lane.prepare (getOversampledRate (currentOversamplingIndex),
+                          targetDrive, targetTightness, targetSag);
+        }
+        lanes[activeLane].setLatencyPad (getLatencyPadTarget (currentOversamplingIndex), 0);
+        latencyPadPending = false;
+
+        // Scratch buffer for the incoming lane during an oversampling crossfade
+        transitionBuffer.setSize (numChannels, maxBlockSize, false, true, false);
 
         // Prepare tone filtering at original sample rate
         tone.prepare (spec);
@@ -77,84 +96,50 @@ public:
         // Noise gate — custom state machine (hysteresis, see pitfalls notes)
         // The JUCE NoiseGate has no hysteresis; we implement dual-threshold manually.
         recalculateGateCoefficients();
+        gatePeakWindow.prepare (maxGateLookaheadSamples + 1);
+        gateGainBuffer.assign (static_cast<size_t> (maxBlockSize), 1.0f);
         gateEnvelope = 0.0f;
         gateGainSmoother.reset (static_cast<float> (sampleRate), 0.001);  // 1ms smoother
         gateGainSmoother.setCurrentAndTargetValue (1.0f);
         gateIsOpen = false;
 
-        // Drive smoothing: 10ms ramp (at oversampled rate)
-        driveSmoother.reset (oversampledRate, 0.010);
-        driveSmoother.setCurrentAndTargetValue (targetDrive);
-
-        // Other parameter smoothers: 5ms ramp (at oversampled rate)
-        tightnessSmoother.reset (oversampledRate, 0.005);
-        tightnessSmoother.setCurrentAndTargetValue (targetTightness);
-
-        sagSmoother.reset (oversampledRate, 0.005);
-        sagSmoother.setCurrentAndTargetValue (targetSag);
+        // Next applyParameters() pushes every field
+        parametersApplied = false;
     }
 
     void process (juce::AudioBuffer<float>& buffer)
     {
         const int chCount = juce::jmin (numChannels, buffer.getNumChannels());
 
-        // 1. Optional noise gate (pre-distortion, CONTEXT.md locked)
-        if (gateEnabled)
+        // 1. Optional noise gate (pre-distortion, CONTEXT.md locked).
+        //    Lookahead mode only runs the detector here; its gain is applied after step 5.
+        const bool lookaheadGate = gateEnabled && gateLookahead
+                                   && buffer.getNumSamples() <= static_cast<int> (gateGainBuffer.size());
+        if (lookaheadGate)
+            computeLookaheadGateGains (buffer, chCount);
+        else if (gateEnabled)
             applyNoiseGate (buffer, chCount);
 
-        // 2. Upsample
-        juce::dsp::AudioBlock<float> block (buffer);
-        auto& os = *oversamplingObjects[currentOversamplingIndex];
-        auto oversampledBlock = os.processSamplesUp (block);
+        if (gateEnabled)
+            lapStage (StageTimers::Stage::gate);
 
-        // 3. Per-channel per-sample waveshaping in oversampled domain
-        const int numSamples = static_cast<int> (oversampledBlock.getNumSamples());
+        // 2–4. Upsample → waveshape → downsample (crossfading two lanes during a rate switch)
+        if (transition.active)
+            processTransition (buffer, chCount);
+        else
+            processLane (lanes[activeLane], currentOversamplingIndex,
+                         juce::dsp::AudioBlock<float> (buffer), chCount);
 
-        // Set smoother targets
-        driveSmoother.setTargetValue (targetDrive);
-        tightnessSmoother.setTargetValue (targetTightness);
-        sagSmoother.setTargetValue (targetSag);
+        // 5. Apply tone filtering + presence + DC blocker (at original rate)
+        tone.applyTone (buffer);
+        lapStage (StageTimers::Stage::tone);
 
-        for (int ch = 0; ch < chCount; ++ch)
+        // 6. Lookahead gate gain — the output lags the detector by the oversampling latency
+        if (lookaheadGate)
         {
-            auto* data = oversampledBlock.getChannelPointer (static_cast<size_t> (ch));
-
-            for (int s = 0; s < numSamples; ++s)
-            {
-                float drive, tightness, sag;
-
-                // Only advance smoothers on ch 0; read current value on remaining channels
-                // (same pattern as GunkLord FuzzStage)
-                if (ch == 0)
-                {
-                    drive     = driveSmoother.getNextValue();
-                    tightness = tightnessSmoother.getNextValue();
-                    sag       = sagSmoother.getNextValue();
-                }
-                else
-                {
-                    drive     = driveSmoother.getCurrentValue();
-                    tightness = tightnessSmoother.getCurrentValue();
-                    sag       = sagSmoother.getCurrentValue();
-                }
-
-                // Tightness filter cutoff: 0 = 20 Hz (full bass), 1 = 800 Hz (tight)
-                // CLAYMORE CHANGE: extended from GunkLord's 20–300 Hz to 20–800 Hz
-                const float tightCutoff = 20.0f + tightness * 780.0f;
-                coreState[ch].tightnessFilter.setCutoffFrequency (tightCutoff);
-
-                const float mappedDrive = FuzzConfig::mapDrive (drive);
-                data[s] = FuzzCore::processSample (data[s], mappedDrive, targetClipType, sag,
-                                                    coreState[ch]);
-                data[s] *= FuzzConfig::outputCompensation;
-            }
+            applyLookaheadGateGains (buffer, chCount);
+            lapStage (StageTimers::Stage::gate);
         }
-
-        // 4. Downsample
-        os.processSamplesDown (block);
-
-        // 5. Apply tone filtering + presence + DC blocker (at original rate)
-        tone.applyTone (buffer);
     }
 
     void reset()
@@ -164,28 +149,93 @@ public:
                 oversamplingObjects[i]->reset();
 
         for (int ch = 0; ch < maxChannels; ++ch)
-        {
-            coreState[ch].reset();
             sidechainHPF[ch].reset();
-        }
 
-        tone.reset();
+        // Abandon any in-flight crossfade — the incoming lane becomes idle again and the
+        // outgoing one, still the running rate, drops its alignment pad
+        transition.active = false;
+
+        for (auto& lane : lanes)
+            lane.reset (targetDrive, targetTightness, targetSag);
 
-        driveSmoother.setCurrentAndTargetValue (targetDrive);
-        tightnessSmoother.setCurrentAndTargetValue (targetTightness);
-        sagSmoother.setCurrentAndTargetValue (targetSag);
+        lanes[activeLane].setLatencyPad (getLatencyPadTarget (currentOversamplingIndex), 0);
+        latencyPadPending = false;
+
+        tone.reset();
 
         gateEnvelope = 0.0f;
         gateIsOpen   = false;
         gateGainSmoother.setCurrentAndTargetValue (gateEnabled ? 1.0f : 1.0f);
+        gatePeakWindow.reset();
     }
 
+    /**
+     * Latency of the running rate, or of the latency reference if that is higher.
+     * During a crossfade this is still the outgoing rate's; the new value applies once
+     * the fade has completed (the wet output itself: getOutputLatencyInSamples()).
+     */
     float getLatencyInSamples() const
     {
-        return oversamplingObjects[currentOversamplingIndex]->getLatencyInSamples();
+        const float running = oversamplingObjects[currentOversamplingIndex]->getLatencyInSamples();
+
+        if (latencyReferenceIndex < 0)
+            return running;
+
+        return juce::jmax (running, oversamplingObjects[latencyReferenceIndex]->getLatencyInSamples());
+    }
+
+    /**
+     * Latency of the wet output as it leaves process() now: the running rate's plus the
+     * audible lane's current latency pad. During a crossfade that is the aligned latency
+     * both lanes are padded to (reached by the end of the prime), and while a pad glides
+     * it follows the glide. Use it for anything timed against the wet path (dry/wet
+     * mixer, lookahead gate); the host keeps getLatencyInSamples().
+     */
+    float getOutputLatencyInSamples() const
+    {
+        return oversamplingObjects[currentOversamplingIndex]->getLatencyInSamples()
+             + lanes[activeLane].padSamples;
+    }
+
+    /**
+     * Engine-facing slice of the plugin's parameter snapshot (see ParameterSnapshot.h).
+     * Plain values in APVTS units; applyParameters() does the clamping.
+     */
+    struct Parameters
+    {
+        float drive           = 0.5f;
+        int   clipType        = 0;      // ClipType::Silicon
+        float tightness       = 0.0f;
+        float sag             = 0.0f;
+        float tone            = 0.5f;
+        float presence        = 0.5f;
+        bool  gateEnabled     = false;
+        float gateThresholdDB = -40.0f;
+    };
+
+    /**
+     * Apply a parameter snapshot, calling only the setters whose value changed since the
+     * previous call. The first call after prepare() applies every field.
+     * Called from PluginProcessor::processBlock() only when the snapshot was rebuilt.
+     */
+    void applyParameters (const Parameters& p)
+    {
+        const bool all = ! parametersApplied;
+
+        if (all || p.drive           != appliedParameters.drive)           setDrive         (p.drive);
+        if (all || p.clipType        != appliedParameters.clipType)        setClipType      (p.clipType);
+        if (all || p.tightness       != appliedParameters.tightness)       setTightness     (p.tightness);
+        if (all || p.sag             != appliedParameters.sag)             setSag           (p.sag);
+        if (all || p.tone            != appliedParameters.tone)            setTone          (p.tone);
+        if (all || p.presence        != appliedParameters.presence)        setPresence      (p.presence);
+        if (all || p.gateEnabled     != appliedParameters.gateEnabled)     setGateEnabled   (p.gateEnabled);
+        if (all || p.gateThresholdDB != appliedParameters.gateThresholdDB) setGateThreshold (p.gateThresholdDB);
+
+        appliedParameters = p;
+        parametersApplied = true;
     }
 
-    // --- Parameter setters (called per-block by PluginProcessor) ---
+    // --- Parameter setters (individual; applyParameters() is the per-block entry point) ---
 
     void setDrive     (float drive)    { targetDrive     = juce::jlimit (0.0f, 1.0f, drive); }
     void setClipType  (int type)       { targetClipType  = juce::jlimit (0, static_cast<int> (ClipType::Rectifier), type); }
@@ -194,35 +244,118 @@ public:
     void setTone      (float toneVal)  { tone.setTone     (juce::jlimit (0.0f, 1.0f, toneVal)); }
     void setPresence  (float presence) { tone.setPresence (juce::jlimit (0.0f, 1.0f, presence)); }
 
+    /** How setOversamplingFactor() moves between rates. */
+    enum class OversamplingSwitch
+    {
+        immediate,  // Hard switch: reset and re-prepare in place (used from prepareToPlay)
+        crossfade   // Run outgoing + incoming rates in parallel and crossfade (live switching)
+    };
+
     /**
      * Switch to a different oversampling rate.
      * index: 0 = 2x, 1 = 4x, 2 = 8x
      *
-     * Called from PluginProcessor::processBlock() on rate change (QUAL-01).
-     * Safe to call from the audio thread — no allocation, no locks.
-     * Resets stale filter state, re-prepares smoothers and FuzzCoreState at new rate.
+     * Called from PluginProcessor::processBlock() every block with the requested index
+     * (QUAL-01). Safe to call from the audio thread — no allocation, no locks.
+     *
+     * Crossfade mode primes the incoming rate's lane (FuzzCoreState, smoothers, a reset
+     * Oversampling object) and runs it silently for transitionPrimeMs so its IIR filters
+     * settle, then fades from the outgoing to the incoming rate over transitionFadeMs.
+     * The two rates have different latencies, so both lanes are padded to the higher one
+     * for the fade (mixing them unaligned would comb-filter): the incoming lane from the
+     * start, the outgoing lane gliding there during the prime. The new rate — index and
+     * latency — is committed when the fade ends.
+     * Only one crossfade runs at a time: requests arriving mid-fade are ignored and picked
+     * up by the next call after the fade completes, so an automation lane flipping rates
+     * can never stack more than one extra lane. Extra CPU is therefore capped at one
+     * additional oversampled lane for at most (prime + fade) samples, and is measured —
+     * see getLastOversamplingSwitchLoad().
      */
-    void setOversamplingFactor (int index)
+    void setOversamplingFactor (int index, OversamplingSwitch mode = OversamplingSwitch::crossfade)
     {
         const int newIndex = juce::jlimit (0, numOversamplingFactors - 1, index);
-        if (newIndex == currentOversamplingIndex)
+
+        if (mode == OversamplingSwitch::immediate)
+        {
+            if (transition.active)
+                finishTransition();
+
+            if (newIndex != currentOversamplingIndex)
+                switchOversamplingImmediately (newIndex);
+        }
+        // Coalesce: the caller re-requests every block, so the latest index wins after the fade
+        else if (! transition.active && newIndex != currentOversamplingIndex)
+        {
+            if (transitionBuffer.getNumSamples() == 0)
+                switchOversamplingImmediately (newIndex);  // not prepared yet — nothing audible to fade
+            else
+                beginTransition (newIndex);
+        }
+
+        // Reference changed without a switch to carry it (a crossfade applies it when done)
+        if (latencyPadPending && ! transition.active)
+        {
+            lanes[activeLane].setLatencyPad (getLatencyPadTarget (currentOversamplingIndex), getLatencyGlideSamples());
+            latencyPadPending = false;
+        }
+    }
+
+    /** Oversampling index currently running (the outgoing one during a crossfade). */
+    int getOversamplingIndex() const { return currentOversamplingIndex; }
+
+    /**
+     * Oversampling index whose latency the engine keeps (-1 = none, the default: latency
+     * follows the running rate). A lower running rate — QualityGovernor stepping below the
+     * selected factor — has its output delayed (3rd-order Lagrange, fractional) by the
+     * latency difference, so getLatencyInSamples() and the output timing do not move.
+     *
+     * Takes effect with the next setOversamplingFactor() call: a lane entering through a
+     * crossfade is padded for the new reference while the outgoing lane keeps its timing.
+     * If the rate does not change, the running lane's padding glides to the new value over
+     * latencyGlideMs. A lane whose pad is 0 skips the delay entirely.
+     */
+    void setLatencyReference (int index)
+    {
+        const int newIndex = index < 0 ? -1 : juce::jlimit (0, numOversamplingFactors - 1, index);
+        if (newIndex == latencyReferenceIndex)
             return;
 
-        // Reset the OLD oversampling object's filter state (prevents stale state artifacts)
-        oversamplingObjects[currentOversamplingIndex]->reset();
+        latencyReferenceIndex = newIndex;
+        latencyPadPending     = true;
+    }
 
-        currentOversamplingIndex = newIndex;
+    /** Latency reference set by setLatencyReference() (-1 = none). */
+    int getLatencyReference() const { return latencyReferenceIndex; }
 
-        // Recalculate oversampled rate for smoothers and FuzzCoreState
-        const double newOsRate = sampleRate * std::pow (2.0, currentOversamplingIndex + 1);
+    /** True while an oversampling crossfade is running (two lanes active). */
+    bool isOversamplingTransitionActive() const { return transition.active; }
 
-        driveSmoother.reset (newOsRate, 0.010);
-        tightnessSmoother.reset (newOsRate, 0.005);
-        sagSmoother.reset (newOsRate, 0.005);
+    /**
+     * Extra CPU spent by the incoming lane during the last completed crossfade,
+     * as a fraction of the crossfade's real-time duration (0.25 = 25% of one core
+     * for the length of the fade). Written on the audio thread, safe to read anywhere;
+     * ClaymoreBench --suite=switch reports it.
+     */
+    float getLastOversamplingSwitchLoad() const { return lastSwitchLoad.load (std::memory_order_relaxed); }
 
-        // Re-prepare FuzzCoreState at new oversampled rate
-        for (int ch = 0; ch < maxChannels; ++ch)
-            coreState[ch].prepare (newOsRate);
+    /** The upsample and downsample stages alone, at the running rate (nothing shaped in between). */
+    void processOversamplingStages (juce::dsp::AudioBlock<float> block)
+    {
+        auto& os = *oversamplingObjects[currentOversamplingIndex];
+        os.processSamplesUp (block);
+        os.processSamplesDown (block);
+    }
+
+    /**
+     * The shape stage alone: the running lane's waveshaping (the code process() runs
+     * between upsample and downsample) on a block already at the running oversampled
+     * rate, with the current parameters. No oversampling, latency pad or crossfade.
+     * Both are for ClaymoreBench's per-stage measurements; process() is the audio path.
+     */
+    void processShaperStage (juce::dsp::AudioBlock<float> oversampledBlock)
+    {
+        const int chCount = juce::jmin (numChannels, static_cast<int> (oversampledBlock.getNumChannels()));
+        lanes[activeLane].process (oversampledBlock, chCount, targetDrive, targetClipType, targetTightness, targetSag);
     }
 
     void setGateEnabled (bool enabled)
@@ -234,6 +367,7 @@ public:
             gateIsOpen   = false;
             gateEnvelope = 0.0f;
             gateGainSmoother.setCurrentAndTargetValue (1.0f);
+            gatePeakWindow.reset();
         }
     }
 
@@ -245,11 +379,20 @@ public:
     }
 
     // --- Hidden gate parameters (Phase 3 exposes via right-click context menu) ---
+    // Audio thread only: the editor's changes reach these through ClaymoreProcessor's
+    // GateCommandQueue, drained at block boundaries.
+
+    // Ranges the setters clamp to — ClaymoreProcessor clamps its editor-side copy with these too
+    static float limitGateAttack       (float ms) { return juce::jlimit (0.1f, 100.0f, ms); }
+    static float limitGateRelease      (float ms) { return juce::jlimit (1.0f, 2000.0f, ms); }
+    static float limitGateHysteresis   (float dB) { return juce::jlimit (0.0f, 12.0f, dB); }
+    static float limitGateRange        (float dB) { return juce::jlimit (-120.0f, -6.0f, dB); }
+    static float limitGateSidechainHPF (float hz) { return juce::jlimit (20.0f, 2000.0f, hz); }
 
     /** Attack time in milliseconds. Faster = more transient click suppression. Default: 1ms. */
     void setGateAttack (float attackMs)
     {
-        gateAttackMs = juce::jlimit (0.1f, 100.0f, attackMs);
+        gateAttackMs = limitGateAttack (attackMs);
         if (sampleRate > 0.0)
             recalculateGateCoefficients();
     }
@@ -257,7 +400,7 @@ public:
     /** Release time in milliseconds. Longer = more natural tail. Default: 80ms. */
     void setGateRelease (float releaseMs)
     {
-        gateReleaseMs = juce::jlimit (1.0f, 2000.0f, releaseMs);
+        gateReleaseMs = limitGateRelease (releaseMs);
         if (sampleRate > 0.0)
             recalculateGateCoefficients();
     }
@@ -279,7 +422,7 @@ public:
      */
     void setGateSidechainHPF (float hz)
     {
-        gateSidechainHPFHz = juce::jlimit (20.0f, 2000.0f, hz);
+        gateSidechainHPFHz = limitGateSidechainHPF (hz);
         for (int ch = 0; ch < maxChannels; ++ch)
             sidechainHPF[ch].setCutoffFrequency (gateSidechainHPFHz);
     }
@@ -290,7 +433,7 @@ public:
      */
     void setGateRange (float rangeDB)
     {
-        gateRangeDB = juce::jlimit (-120.0f, -6.0f, rangeDB);
+        gateRangeDB = limitGateRange (rangeDB);
     }
 
     /**
@@ -299,62 +442,499 @@ public:
      */
     void setGateHysteresis (float hysteresisDB)
     {
-        gateHysteresisDB = juce::jlimit (0.0f, 12.0f, hysteresisDB);
+        gateHysteresisDB = limitGateHysteresis (hysteresisDB);
         // Recalculate close threshold based on new hysteresis
         gateCloseThreshold = gateOpenThreshold - gateHysteresisDB;
     }
 
+    /**
+     * Lookahead mode: the detector still listens to the pre-distortion input (after the
+     * sidechain HPF), but the gain is applied to the engine output, which already lags
+     * the input by the oversampling latency the host is compensating for. The detector
+     * takes the sliding maximum over that latency window, so the gate opens before a
+     * palm-muted attack reaches the output — with no extra reported latency.
+     * Trade-off: closed-gate attenuation happens after the fuzz instead of before it.
+     * Default: off (classic pre-distortion gate).
+     */
+    void setGateLookahead (bool enabled)
+    {
+        gateLookahead = enabled;
+        gatePeakWindow.reset();
+    }
+
     // --- Gate parameter getters (for advanced menu display) ---
     float getGateAttack()       const { return gateAttackMs; }
     float getGateRelease()      const { return gateReleaseMs; }
     float getGateHysteresis()   const { return gateHysteresisDB; }
     float getGateRange()        const { return gateRangeDB; }
     float getGateSidechainHPF() const { return gateSidechainHPFHz; }
+    bool  getGateLookahead()    const { return gateLookahead; }
+
+    /**
+     * Stage timers for the host's timing overlay and trace (StageTimers.h): process() laps
+     * the gate, upsample, shape, downsample and tone stages on this clock and marks
+     * oversampling switches. Null = untimed.
+     */
+    void setStageClock (StageTimers::Clock* clock) { stageClock = clock; }
+
+    /** Gate gain at the end of the last processed block (1 = open or disabled). For metering. */
+    float getGateGain() const { return gateEnabled ? gateGainSmoother.getCurrentValue() : 1.0f; }
 
 private:
+    static constexpr int maxChannels = 8;
+
+    // Oversampling crossfade window (see setOversamplingFactor)
+    static constexpr double transitionPrimeMs    = 2.0;   // incoming lane runs silently
+    static constexpr double transitionFadeMs     = 10.0;  // linear outgoing → incoming fade
+    static constexpr int    maxTransitionSamples = 4096;  // caps the window at high sample rates
+
+    // Latency padding capacity — the 2x→8x difference of the IIR oversamplers is a few samples
+    static constexpr int    maxLatencyPadSamples = 64;
+    static constexpr double latencyGlideMs       = 2.0;  // pad changes on an audible lane
+
+    /**
+     * One oversampled waveshaping path: per-channel FuzzCoreState plus the smoothers
+     * that run at its oversampled rate, and the base-rate delay that pads its latency up
+     * to the latency reference. The engine owns two so an incoming rate can be primed and
+     * crossfaded while the outgoing rate keeps running.
+     */
+    struct ShaperLane
+    {
+        FuzzCoreState coreState[maxChannels];
+
+        // Parameter smoothers (clipType is discrete — no smoother needed)
+        juce::SmoothedValue<float> driveSmoother;
+        juce::SmoothedValue<float> tightnessSmoother;
+        juce::SmoothedValue<float> sagSmoother;
+
+        // Latency padding (see setLatencyReference) — allocated in prepareLatencyPad() only.
+        // Bypassed while both the pad and its target are 0.
+        juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> latencyPad;
+        float padSamples = 0.0f;   // current delay
+        float padTarget  = 0.0f;
+        float padStep    = 0.0f;   // per-sample glide increment
+        int   padWarmup  = 0;      // samples held at delay 0 while the history refills
+
+        void prepareLatencyPad (const juce::dsp::ProcessSpec& spec)
+        {
+            latencyPad.setMaximumDelayInSamples (maxLatencyPadSamples);
+            latencyPad.prepare (spec);
+            padSamples = padTarget = padStep = 0.0f;
+            padWarmup  = 0;
+        }
+
+        bool isPadding() const { return padSamples > 0.0f || padTarget > 0.0f; }
+
+        /**
+         * Moves the pad to `target` samples: at once (glideSamples = 0 — only while the lane
+         * is silent or freshly reset) or as a linear glide, a brief pitch bend instead of a
+         * jump. A bypassed lane has no delay history, so before gliding it first runs at
+         * delay 0 for the 3 samples Lagrange3rd reads behind the current one.
+         */
+        void setLatencyPad (float target, int glideSamples)
+        {
+            target = juce::jlimit (0.0f, static_cast<float> (maxLatencyPadSamples), target);
+
+            if (glideSamples <= 0)
+            {
+                padSamples = padTarget = target;
+                padStep    = 0.0f;
+                padWarmup  = 0;
+                latencyPad.setDelay (target);
+                return;
+            }
+
+            if (! isPadding() && target > 0.0f)
+            {
+                latencyPad.reset();
+                padWarmup = 3;
+            }
+
+            padTarget = target;
+            padStep   = (padTarget - padSamples) / static_cast<float> (glideSamples);
+        }
+
+        void prepare (double oversampledRate, float drive, float tightness, float sag)
+        {
+            for (auto& state : coreState)
+                state.prepare (oversampledRate);
+
+            // Drive smoothing: 10ms ramp; other parameters: 5ms ramp (at oversampled rate)
+            driveSmoother.reset     (oversampledRate, 0.010);
+            tightnessSmoother.reset (oversampledRate, 0.005);
+            sagSmoother.reset       (oversampledRate, 0.005);
+
+            reset (drive, tightness, sag);
+        }
+
+        void reset (float drive, float tightness, float sag)
+        {
+            for (auto& state : coreState)
+                state.reset();
+
+            driveSmoother.setCurrentAndTargetValue (drive);
+            tightnessSmoother.setCurrentAndTargetValue (tightness);
+            sagSmoother.setCurrentAndTargetValue (sag);
+
+            latencyPad.reset();
+        }
+
+        /** Delays the lane's base-rate output by the latency pad; no-op while bypassed. */
+        void padLatency (juce::dsp::AudioBlock<float> block, int chCount)
+        {
+            if (! isPadding())
+                return;
+
+            const int numSamples = static_cast<int> (block.getNumSamples());
+
+            // Steady pad: channel by channel at a fixed delay
+            if (padSamples == padTarget && padWarmup == 0)
+            {
+                for (int ch = 0; ch < chCount; ++ch)
+                {
+                    auto* data = block.getChannelPointer (static_cast<size_t> (ch));
+
+                    for (int s = 0; s < numSamples; ++s)
+                    {
+                        latencyPad.pushSample (ch, data[s]);
+                        data[s] = latencyPad.popSample (ch);
+                    }
+                }
+                return;
+            }
+
+            // Warm-up / glide: the delay moves per sample, shared by all channels
+            for (int s = 0; s < numSamples; ++s)
+            {
+                if (padWarmup > 0)
+                    --padWarmup;
+                else if (padSamples != padTarget)
+                    padSamples = padStep > 0.0f ? juce::jmin (padTarget, padSamples + padStep)
+                                                : juce::jmax (padTarget, padSamples + padStep);
+
+                latencyPad.setDelay (padSamples);
+
+                for (int ch = 0; ch < chCount; ++ch)
+                {
+                    auto* data = block.getChannelPointer (static_cast<size_t> (ch));
+                    latencyPad.pushSample (ch, data[s]);
+                    data[s] = latencyPad.popSample (ch);
+                }
+            }
+        }
+
+        /** Per-channel per-sample waveshaping of an already-upsampled block. */
+        void process (juce::dsp::AudioBlock<float> oversampledBlock, int chCount,
+                      float drive, int clipType, float tightness, float sag)
+        {
+            const int numSamples = static_cast<int> (oversampledBlock.getNumSamples());
+
+            // Set smoother targets
+            driveSmoother.setTargetValue (drive);
+            tightnessSmoother.setTargetValue (tightness);
+            sagSmoother.setTargetValue (sag);
+
+            for (int ch = 0; ch < chCount; ++ch)
+            {
+                auto* data = oversampledBlock.getChannelPointer (static_cast<size_t> (ch));
+
+                for (int s = 0; s < numSamples; ++s)
+                {
+                    float drv, tight, sg;
+
+                    // Only advance smoothers on ch 0; read current value on remaining channels
+                    // (same pattern as GunkLord FuzzStage)
+                    if (ch == 0)
+                    {
+                        drv   = driveSmoother.getNextValue();
+                        tight = tightnessSmoother.getNextValue();
+                        sg    = sagSmoother.getNextValue();
+                    }
+                    else
+                    {
+                        drv   = driveSmoother.getCurrentValue();
+                        tight = tightnessSmoother.getCurrentValue();
+                        sg    = sagSmoother.getCurrentValue();
+                    }
+
+                    // Tightness filter cutoff: 0 = 20 Hz (full bass), 1 = 800 Hz (tight)
+                    // CLAYMORE CHANGE: extended from GunkLord's 20–300 Hz to 20–800 Hz
+                    const float tightCutoff = 20.0f + tight * 780.0f;
+                    coreState[ch].tightnessFilter.setCutoffFrequency (tightCutoff);
+
+                    const float mappedDrive = FuzzConfig::mapDrive (drv);
+                    data[s] = FuzzCore::processSample (data[s], mappedDrive, clipType, sg,
+                                                        coreState[ch]);
+                    data[s] *= FuzzConfig::outputCompensation;
+                }
+            }
+        }
+    };
+
+    double getOversampledRate (int osIndex) const
+    {
+        return sampleRate * std::pow (2.0, osIndex + 1);
+    }
+
+    /** Upsample → waveshape → downsample one block through the given lane and rate. */
+    void processLane (ShaperLane& lane, int osIndex, juce::dsp::AudioBlock<float> block, int chCount)
+    {
+        auto& os = *oversamplingObjects[osIndex];
+        auto oversampledBlock = os.processSamplesUp (block);
+        lapStage (StageTimers::Stage::upsample);
+
+        lane.process (oversampledBlock, chCount, targetDrive, targetClipType, targetTightness, targetSag);
+        lapStage (StageTimers::Stage::shape);
+
+        os.processSamplesDown (block);
+        lane.padLatency (block, chCount);
+        lapStage (StageTimers::Stage::downsample);
+    }
+
+    /** Latency pad for running at osIndex: reference latency minus its own (0 without a reference). */
+    float getLatencyPadTarget (int osIndex) const
+    {
+        if (latencyReferenceIndex < 0)
+            return 0.0f;
+
+        return juce::jmax (0.0f, oversamplingObjects[latencyReferenceIndex]->getLatencyInSamples()
+                                   - oversamplingObjects[osIndex]->getLatencyInSamples());
+    }
+
+    int getLatencyGlideSamples() const
+    {
+        return juce::jmax (1, juce::roundToInt (sampleRate * latencyGlideMs / 1000.0));
+    }
+
+    void lapStage (StageTimers::Stage stage)
+    {
+        if (stageClock != nullptr)
+            stageClock->lap (stage);
+    }
+
+    void markStage (const char* name, const char* argName0, int arg0, const char* argName1 = nullptr, int arg1 = 0)
+    {
+        if (stageClock != nullptr)
+            stageClock->mark (name, argName0, arg0, argName1, arg1);
+    }
+
+    // --- Oversampling rate switching ---
+
+    /** Hard switch (previous behaviour): reset old filters, re-prepare the active lane in place. */
+    void switchOversamplingImmediately (int newIndex)
+    {
+        markStage ("oversampling switch", "from", 2 << currentOversamplingIndex, "to", 2 << newIndex);
+
+        // Reset the OLD oversampling object's filter state (prevents stale state artifacts)
+        oversamplingObjects[currentOversamplingIndex]->reset();
+
+        currentOversamplingIndex = newIndex;
+
+        // Re-prepare FuzzCoreState and smoothers at the new oversampled rate
+        lanes[activeLane].prepare (getOversampledRate (currentOversamplingIndex),
+                                   targetDrive, targetTightness, targetSag);
+        lanes[activeLane].setLatencyPad (getLatencyPadTarget (currentOversamplingIndex), 0);
+    }
+
+    void beginTransition (int newIndex)
+    {
+        markStage ("oversampling crossfade start", "from", 2 << currentOversamplingIndex, "to", 2 << newIndex);
+
+        // The running rate stays committed until finishTransition()
+        transition.fromIndex = currentOversamplingIndex;
+        transition.toIndex   = newIndex;
+
+        transition.primeSamples = juce::jmax (1, juce::jmin (maxTransitionSamples / 4,
+                                                             juce::roundToInt (sampleRate * transitionPrimeMs / 1000.0)));
+
+        // Prime the incoming rate: clean Oversampling filters, fresh lane at the new rate
+        // with smoothers already sitting on the current targets (no ramp inside the fade)
+        oversamplingObjects[newIndex]->reset();
+        lanes[1 - activeLane].prepare (getOversampledRate (newIndex),
+                                       targetDrive, targetTightness, targetSag);
+
+        // Align both lanes on the higher latency: the silent incoming lane at once, the
+        // audible outgoing one gliding there before the fade starts
+        const float fromLatency = oversamplingObjects[transition.fromIndex]->getLatencyInSamples();
+        const float toLatency   = oversamplingObjects[newIndex]->getLatencyInSamples();
+        const float aligned     = juce::jmax (fromLatency + getLatencyPadTarget (transition.fromIndex),
+                                              toLatency   + getLatencyPadTarget (newIndex));
+
+        lanes[1 - activeLane].setLatencyPad (aligned - toLatency, 0);
+        lanes[activeLane].setLatencyPad (aligned - fromLatency, transition.primeSamples);
+
+        transition.fadeSamples  = juce::jlimit (1, maxTransitionSamples - transition.primeSamples,
+                                                juce::roundToInt (sampleRate * transitionFadeMs / 1000.0));
+        transition.position     = 0;
+        transition.extraTicks   = 0;
+        transition.active       = true;
+    }
+
+    void processTransition (juce::AudioBuffer<float>& buffer, int chCount)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        // Scratch too small for this block (host exceeded maximumBlockSize) — complete the switch
+        if (numSamples > transitionBuffer.getNumSamples()
+            || buffer.getNumChannels() > transitionBuffer.getNumChannels())
+        {
+            finishTransition();
+            processLane (lanes[activeLane], currentOversamplingIndex,
+                         juce::dsp::AudioBlock<float> (buffer), chCount);
+            return;
+        }
+
+        juce::dsp::AudioBlock<float> outgoingBlock (buffer);
+        auto incomingBlock = juce::dsp::AudioBlock<float> (transitionBuffer)
+                                 .getSubsetChannelBlock (0, outgoingBlock.getNumChannels())
+                                 .getSubBlock (0, static_cast<size_t> (numSamples));
+        incomingBlock.copyFrom (outgoingBlock);
+
+        // Outgoing rate keeps producing output until the fade completes
+        processLane (lanes[activeLane], transition.fromIndex, outgoingBlock, chCount);
+
+        // Incoming rate — the only extra work during a switch, timed for getLastOversamplingSwitchLoad()
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        processLane (lanes[1 - activeLane], transition.toIndex, incomingBlock, chCount);
+        transition.extraTicks += juce::Time::getHighResolutionTicks() - startTicks;
+
+        // Linear crossfade: silent during priming, then ramps 0 → 1 over fadeSamples
+        const float fadeStep = 1.0f / static_cast<float> (transition.fadeSamples);
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            auto* out      = outgoingBlock.getChannelPointer (static_cast<size_t> (ch));
+            const auto* in = incomingBlock.getChannelPointer (static_cast<size_t> (ch));
+
+            for (int s = 0; s < numSamples; ++s)
+            {
+                const float fade = juce::jlimit (0.0f, 1.0f,
+                    static_cast<float> (transition.position + s - transition.primeSamples) * fadeStep);
+                out[s] += fade * (in[s] - out[s]);
+            }
+        }
+        lapStage (StageTimers::Stage::shape);
+
+        transition.position += numSamples;
+        if (transition.position >= transition.primeSamples + transition.fadeSamples)
+            finishTransition();
+    }
+
+    void finishTransition()
+    {
+        const double windowSeconds = static_cast<double> (juce::jmax (1, transition.position)) / sampleRate;
+        lastSwitchLoad.store (static_cast<float> (
+            juce::Time::highResolutionTicksToSeconds (transition.extraTicks) / windowSeconds),
+            std::memory_order_relaxed);
+
+        oversamplingObjects[transition.fromIndex]->reset();
+        currentOversamplingIndex = transition.toIndex;
+        activeLane               = 1 - activeLane;
+        transition.active        = false;
+
+        // Drop the alignment pad to the committed rate's own (also picks up a reference
+        // change that arrived mid-fade)
+        lanes[activeLane].setLatencyPad (getLatencyPadTarget (currentOversamplingIndex), getLatencyGlideSamples());
+        latencyPadPending = false;
+
+        markStage ("oversampling crossfade end", "to", 2 << currentOversamplingIndex);
+    }
+
     // --- Noise gate with hysteresis ---
     // Custom state machine: envelope follower + dual-threshold logic.
     // JUCE's NoiseGate does not expose hysteresis; this avoids chatter on borderline signals.
     void applyNoiseGate (juce::AudioBuffer<float>& buffer, int chCount)
     {
-        const int   numSamples         = buffer.getNumSamples();
-        const float openThreshLinear   = juce::Decibels::decibelsToGain (gateOpenThreshold);
-        const float closeThreshLinear  = juce::Decibels::decibelsToGain (gateCloseThreshold);
-        // Range scales with ratio: 0 = no attenuation, 1 = full gateRangeDB attenuation
-        const float effectiveRangeDB   = gateRangeDB * gateRatio;
-        const float rangeGain          = juce::Decibels::decibelsToGain (effectiveRangeDB);
+        const int  numSamples = buffer.getNumSamples();
+        const auto levels     = getGateLevels();
 
         for (int s = 0; s < numSamples; ++s)
         {
-            // Measure peak level across all channels at this sample,
-            // after applying sidechain HPF (level detection only — audio path unchanged)
-            float peakLevel = 0.0f;
+            const float gain = advanceGate (detectSidechainPeak (buffer, s, chCount), levels);
             for (int ch = 0; ch < chCount; ++ch)
-            {
-                const float rawSample    = buffer.getSample (ch, s);
-                const float filteredSamp = sidechainHPF[ch].processSample (0, rawSample);
-                peakLevel = juce::jmax (peakLevel, std::abs (filteredSamp));
-            }
+                buffer.setSample (ch, s, buffer.getSample (ch, s) * gain);
+        }
+    }
 
-            // Envelope follower (first-order IIR)
-            if (peakLevel > gateEnvelope)
-                gateEnvelope = gateAttackCoeff * gateEnvelope + (1.0f - gateAttackCoeff) * peakLevel;
-            else
-                gateEnvelope = gateReleaseCoeff * gateEnvelope + (1.0f - gateReleaseCoeff) * peakLevel;
+    /**
+     * Lookahead detector pass over the (pre-distortion) input: fills gateGainBuffer
+     * without touching the audio. Window = the whole-sample oversampling latency, so the
+     * gain computed for input sample s lands on output sample s, which carries input
+     * s - latency — the detector has seen everything up to `latency` samples ahead.
+     */
+    void computeLookaheadGateGains (const juce::AudioBuffer<float>& buffer, int chCount)
+    {
+        const int  numSamples = buffer.getNumSamples();
+        const auto levels     = getGateLevels();
 
-            // Dual-threshold hysteresis state machine
-            if (! gateIsOpen && gateEnvelope >= openThreshLinear)
-                gateIsOpen = true;
-            else if (gateIsOpen && gateEnvelope < closeThreshLinear)
-                gateIsOpen = false;
+        const int lookahead = juce::jlimit (0, maxGateLookaheadSamples,
+                                            static_cast<int> (getOutputLatencyInSamples()));
+        gatePeakWindow.setWindowLength (lookahead + 1);
 
-            // Set gain target: open = 1.0 (pass through), closed = rangeGain (attenuation)
-            gateGainSmoother.setTargetValue (gateIsOpen ? 1.0f : rangeGain);
+        for (int s = 0; s < numSamples; ++s)
+        {
+            const float windowPeak = gatePeakWindow.process (detectSidechainPeak (buffer, s, chCount));
+            gateGainBuffer[static_cast<size_t> (s)] = advanceGate (windowPeak, levels);
+        }
+    }
 
-            const float gain = gateGainSmoother.getNextValue();
-            for (int ch = 0; ch < chCount; ++ch)
-                buffer.setSample (ch, s, buffer.getSample (ch, s) * gain);
+    void applyLookaheadGateGains (juce::AudioBuffer<float>& buffer, int chCount)
+    {
+        for (int ch = 0; ch < chCount; ++ch)
+            juce::FloatVectorOperations::multiply (buffer.getWritePointer (ch), gateGainBuffer.data(),
+                                                   buffer.getNumSamples());
+    }
+
+    struct GateLevels
+    {
+        float openThreshLinear;
+        float closeThreshLinear;
+        float rangeGain;
+    };
+
+    GateLevels getGateLevels() const
+    {
+        // Range scales with ratio: 0 = no attenuation, 1 = full gateRangeDB attenuation
+        const float effectiveRangeDB = gateRangeDB * gateRatio;
+        return { juce::Decibels::decibelsToGain (gateOpenThreshold),
+                 juce::Decibels::decibelsToGain (gateCloseThreshold),
+                 juce::Decibels::decibelsToGain (effectiveRangeDB) };
+    }
+
+    /**
+     * Peak level across all channels at one sample, after the sidechain HPF
+     * (level detection only — audio path unchanged).
+     */
+    float detectSidechainPeak (const juce::AudioBuffer<float>& buffer, int s, int chCount)
+    {
+        float peakLevel = 0.0f;
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            const float rawSample    = buffer.getSample (ch, s);
+            const float filteredSamp = sidechainHPF[ch].processSample (0, rawSample);
+            peakLevel = juce::jmax (peakLevel, std::abs (filteredSamp));
         }
+        return peakLevel;
+    }
+
+    /** Envelope follower + dual-threshold state machine; returns the smoothed gate gain. */
+    float advanceGate (float peakLevel, const GateLevels& levels)
+    {
+        // Envelope follower (first-order IIR)
+        if (peakLevel > gateEnvelope)
+            gateEnvelope = gateAttackCoeff * gateEnvelope + (1.0f - gateAttackCoeff) * peakLevel;
+        else
+            gateEnvelope = gateReleaseCoeff * gateEnvelope + (1.0f - gateReleaseCoeff) * peakLevel;
+
+        // Dual-threshold hysteresis state machine
+        if (! gateIsOpen && gateEnvelope >= levels.openThreshLinear)
+            gateIsOpen = true;
+        else if (gateIsOpen && gateEnvelope < levels.closeThreshLinear)
+            gateIsOpen = false;
+
+        // Set gain target: open = 1.0 (pass through), closed = rangeGain (attenuation)
+        gateGainSmoother.setTargetValue (gateIsOpen ? 1.0f : levels.rangeGain);
+
+        return gateGainSmoother.getNextValue();
     }
 
     void recalculateGateCoefficients()
@@ -365,20 +945,43 @@ private:
     }
 
     // -------------------------------------------------------------------------
-    static constexpr int maxChannels = 8;
-
     // Pre-allocated oversampling objects: index 0 = 2x, 1 = 4x, 2 = 8x
     // All three are created in prepare(); switching is zero-allocation
     static constexpr int numOversamplingFactors = 3;
     std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, numOversamplingFactors> oversamplingObjects;
     int currentOversamplingIndex = 0;  // 0 = 2x (default), 1 = 4x, 2 = 8x
 
-    // Per-channel waveshaping state
-    FuzzCoreState coreState[maxChannels];
+    // Latency reference (see setLatencyReference): -1 = latency follows the running rate.
+    // Pending = changed, running lane not re-padded yet.
+    int  latencyReferenceIndex = -1;
+    bool latencyPadPending     = false;
+
+    // Waveshaping lanes: lanes[activeLane] runs normally; the other is primed and
+    // crossfaded in while the oversampling rate changes
+    ShaperLane lanes[2];
+    int activeLane = 0;
+
+    // In-flight oversampling crossfade (one at a time)
+    struct Transition
+    {
+        bool        active       = false;
+        int         fromIndex    = 0;   // outgoing oversampling index (still currentOversamplingIndex)
+        int         toIndex      = 0;   // incoming, committed in finishTransition()
+        int         primeSamples = 0;
+        int         fadeSamples  = 1;
+        int         position     = 0;   // samples processed since the switch began
+        juce::int64 extraTicks   = 0;   // time spent in the incoming lane
+    } transition;
+
+    juce::AudioBuffer<float> transitionBuffer;
+    std::atomic<float>       lastSwitchLoad { 0.0f };
 
     // Tone and presence filtering
     FuzzTone tone;
 
+    // Host-owned stage clock (null unless built with CLAYMORE_STAGE_TIMERS or CLAYMORE_TRACE)
+    StageTimers::Clock* stageClock = nullptr;
+
     // --- Noise gate state ---
     bool  gateEnabled = false;
     bool  gateIsOpen  = false;
@@ -401,6 +1004,12 @@ private:
     float gateRatio         = 1.0f;    // 1.0 = full range applied
     float gateSidechainHPFHz = 150.0f; // Sidechain HPF cutoff: 150 Hz default
 
+    // Lookahead gate: sliding peak over the oversampling latency + per-sample gain scratch
+    static constexpr int maxGateLookaheadSamples = 256;  // matches DryWetMixer capacity
+    bool               gateLookahead = false;
+    SlidingWindowMax   gatePeakWindow;
+    std::vector<float> gateGainBuffer;
+
     // Sidechain HPF filters — per channel, highpass at gateSidechainHPFHz
     // Applied to the level-detection signal path only (NOT to the audio output)
     juce::dsp::FirstOrderTPTFilter<float> sidechainHPF[maxChannels];
@@ -411,10 +1020,9 @@ private:
     float targetTightness = 0.0f;
     float targetSag       = 0.0f;
 
-    // Parameter smoothers (clipType is discrete — no smoother needed)
-    juce::SmoothedValue<float> driveSmoother;
-    juce::SmoothedValue<float> tightnessSmoother;
-    juce::SmoothedValue<float> sagSmoother;
+    // Last snapshot passed to applyParameters() (diffed against the next one)
+    Parameters appliedParameters;
+    bool       parametersApplied = false;
 
     // Spec
     double sampleRate  = 44100.0;
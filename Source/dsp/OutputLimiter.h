@@ -1,38 +1,390 @@
 #pragma once
 
+#include <cstring>
 #include <juce_dsp/juce_dsp.h>
+#include "SlidingWindowMax.h"
 
 /**
- * Brickwall output limiter — thin wrapper around juce::dsp::Limiter<float>.
+ * Brickwall output limiter — true lookahead, channel-linked, 0 dBFS ceiling.
  *
  * Placed last in the signal chain (after dry/wet mix and output gain).
  * Default threshold: 0 dBFS (prevents digital overs).
- * Uses lookahead + knee for transparent limiting behavior.
+ *
+ * Audio is delayed by the lookahead (0–5 ms, reported to the host as latency) while
+ * the detector runs on the undelayed signal. Work happens in sub-blocks of up to
+ * 64 samples:
+ *   - Fast path: gain at unity and sub-block peak below threshold → pure delay,
+ *     no per-sample detector or gain work at all.
+ *   - Otherwise: O(1) amortized sliding-window peak (SlidingWindowMax, window =
+ *     lookahead + 1) gives the peak of every sample leaving the delay line within
+ *     this sub-block plus the lookahead ahead of it. One target gain is computed per
+ *     sub-block and ramped linearly to it from the previous one with vector multiplies.
+ *
+ * The ramp ends at or below the gain required by every sample entering the delay line
+ * up to the end of the sub-block. When the lookahead is at least one sub-block plus the
+ * true-peak detection delay (22 samples — 0.5 ms at 44.1 kHz) the samples leaving it
+ * now were all covered by the previous sub-block's end gain, so the ramp starts there:
+ * an attack is spread over a whole sub-block and the ceiling still holds by
+ * construction. A shorter lookahead cannot see the peak coming and steps down at once.
+ * Either way a final clip only absorbs float rounding.
+ *
+ * True-peak mode (optional) also detects inter-sample overs: a 4x polyphase windowed-
+ * sinc interpolator (12 taps per phase) evaluates only the three in-between phases —
+ * the on-sample phase is the signal itself — so no oversampled buffer is built. Each
+ * channel keeps a contiguous [history | sub-block] buffer whose tail is carried over
+ * between sub-blocks, and the fast path uses a conservative bound (sample peak times
+ * the interpolator's worst-case gain), so quiet material still skips detection.
+ * An inter-sample peak is found truePeakDelaySamples after the older of the two samples
+ * around it; it is covered as long as the lookahead is at least that long (the 1 ms
+ * default is).
  *
  * SIG-04: Output is limited by brickwall limiter to prevent digital overs.
  */
 class OutputLimiter
 {
 public:
+    static constexpr float maxLookaheadMs = 5.0f;
+
+    /** Lookahead in ms (0–5). Takes effect at the next prepare() — it changes latency. */
+    void setLookahead (float milliseconds) { lookaheadMs = juce::jlimit (0.0f, maxLookaheadMs, milliseconds); }
+
+    /**
+     * Inter-sample (true-peak) detection on/off. Safe to toggle between blocks; switching
+     * it on clears the interpolator history, which stops updating while it is off.
+     */
+    void setTruePeak (bool enabled)
+    {
+        if (enabled && ! truePeak)
+            truePeakHistory.clear();
+
+        truePeak = enabled;
+    }
+    bool isTruePeak() const         { return truePeak; }
+
+    /** Release time in ms (recovery toward unity gain). Takes effect at the next prepare(). */
+    void setRelease (float milliseconds) { releaseMs = juce::jmax (1.0f, milliseconds); }
+
     void prepare (const juce::dsp::ProcessSpec& spec)
     {
-        limiter.prepare (spec);
-        limiter.setThreshold (0.0f);   // 0 dBFS brickwall
-        limiter.setRelease   (50.0f);  // 50ms release — transparent for mixing use
+        sampleRate  = spec.sampleRate;
+        numChannels = static_cast<int> (spec.numChannels);
+
+        lookaheadSamples = juce::roundToInt (sampleRate * lookaheadMs / 1000.0);
+
+        // Sub-block no longer than the lookahead (when possible) so each attack ramp
+        // was already started by the previous sub-block — less the true-peak detection
+        // delay, so the same holds when true-peak is switched on later
+        subBlockSize = juce::jlimit (minSubBlockSize, maxSubBlockSize, lookaheadSamples - truePeakDelaySamples);
+
+        // Ring holds the lookahead plus one sub-block being written
+        const int ringSize = juce::nextPowerOfTwo (lookaheadSamples + subBlockSize);
+        ringMask = ringSize - 1;
+        delayLine.setSize (numChannels, ringSize);
+
+        peakWindow.prepare (lookaheadSamples + 1);
+        peakWindow.setWindowLength (lookaheadSamples + 1);
+
+        // Release coefficient per sub-block (gain recovers exponentially toward 1)
+        releaseCoeff = std::exp (-static_cast<float> (subBlockSize)
+                                 / (static_cast<float> (sampleRate) * releaseMs / 1000.0f));
+
+        // True-peak interpolator: history + one sub-block per channel
+        truePeakHistory.setSize (numChannels, truePeakTaps - 1 + maxSubBlockSize);
+        designTruePeakInterpolator();
+
+        reset();
     }
 
     void process (juce::AudioBuffer<float>& buffer)
     {
-        juce::dsp::AudioBlock<float>              block (buffer);
-        juce::dsp::ProcessContextReplacing<float> context (block);
-        limiter.process (context);
+        const int numSamples = buffer.getNumSamples();
+        const int chCount    = juce::jmin (numChannels, buffer.getNumChannels());
+
+        lowestGain = gain;
+
+        for (int start = 0; start < numSamples; start += subBlockSize)
+            processSubBlock (buffer, chCount, start, juce::jmin (subBlockSize, numSamples - start));
     }
 
     void reset()
     {
-        limiter.reset();
+        delayLine.clear();
+        truePeakHistory.clear();
+        peakWindow.reset();
+        detectorIdle = true;
+        writePos     = 0;
+        gain         = 1.0f;
+        lowestGain   = 1.0f;
     }
 
+    /** Latency introduced by the lookahead delay, in samples. */
+    int getLatencyInSamples() const { return lookaheadSamples; }
+
+    /** Lowest gain applied during the last process() call (1 = no reduction). For metering. */
+    float getLowestGainInLastBlock() const { return lowestGain; }
+
 private:
-    juce::dsp::Limiter<float> limiter;
+    void processSubBlock (juce::AudioBuffer<float>& buffer, int chCount, int start, int length)
+    {
+        // 1. Channel-linked sub-block peak (vectorised)
+        float blockPeak = 0.0f;
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            const auto range = juce::FloatVectorOperations::findMinAndMax (
+                buffer.getReadPointer (ch, start), length);
+            blockPeak = juce::jmax (blockPeak, -range.getStart(), range.getEnd());
+        }
+
+        // True-peak: append the sub-block to each channel's interpolator history
+        float detectPeak = blockPeak;
+        if (truePeak)
+            detectPeak = pushTruePeakHistory (buffer, chCount, start, length);
+
+        // 2. Fast path: unity gain means nothing above threshold is inside the delay line,
+        //    and nothing new is arriving — samples at or below threshold can never lower
+        //    the gain, so the detector history can simply be dropped. In true-peak mode the
+        //    bound is the peak of every sample feeding this sub-block's interpolation
+        //    times the interpolator's worst-case gain.
+        if (gain >= 1.0f && detectPeak <= threshold)
+        {
+            if (truePeak)
+                carryTruePeakHistory (chCount, length);
+
+            if (! detectorIdle)
+            {
+                peakWindow.reset();
+                detectorIdle = true;
+            }
+
+            delaySubBlock (buffer, chCount, start, length);
+            return;
+        }
+
+        detectorIdle = false;
+
+        // 3. Sliding peak over (lookahead + 1) samples, linked across channels
+        {
+            float* levels = levelScratch;
+            juce::FloatVectorOperations::abs (levels, buffer.getReadPointer (0, start), length);
+            for (int ch = 1; ch < chCount; ++ch)
+            {
+                const float* data = buffer.getReadPointer (ch, start);
+                for (int i = 0; i < length; ++i)
+                    levels[i] = juce::jmax (levels[i], std::abs (data[i]));
+            }
+
+            if (truePeak)
+            {
+                accumulateInterSamplePeaks (levels, chCount, length);
+                carryTruePeakHistory (chCount, length);
+            }
+
+            float windowPeak = 0.0f;
+            for (int i = 0; i < length; ++i)
+                windowPeak = juce::jmax (windowPeak, peakWindow.process (levels[i]));
+
+            // 4. One gain target per sub-block, ramped to from the previous one. Without a
+            //    sub-block of lookahead the samples leaving now are not covered yet: step.
+            const float required  = windowPeak > threshold ? threshold / windowPeak : 1.0f;
+            const float startGain = lookaheadSamples - truePeakDelaySamples >= subBlockSize
+                                        ? gain : juce::jmin (gain, required);
+            float endGain = juce::jmin (required, 1.0f - (1.0f - startGain) * releaseCoeff);
+            if (endGain > 0.9999f)
+                endGain = juce::jmin (1.0f, required);
+
+            delaySubBlock (buffer, chCount, start, length);
+            applyGainRamp (buffer, chCount, start, length, startGain, endGain);
+            gain = endGain;
+            lowestGain = juce::jmin (lowestGain, startGain, endGain);
+        }
+    }
+
+    // --- True-peak detection ---
+
+    /**
+     * Windowed-sinc (Hann) 4x interpolator split into phases. Phase p (1..3) estimates the
+     * signal at (n - truePeakDelaySamples + p/4) from x[n - truePeakTaps + 1 .. n]; taps are
+     * stored oldest-first so each phase is a forward dot product over the history buffer.
+     */
+    void designTruePeakInterpolator()
+    {
+        const float half = static_cast<float> (truePeakTaps / 2);
+        float worstGain = 0.0f;
+
+        for (int p = 0; p < truePeakPhases; ++p)
+        {
+            const float frac = static_cast<float> (p + 1) / static_cast<float> (truePeakPhases + 1);
+            float sum = 0.0f;
+
+            for (int j = 0; j < truePeakTaps; ++j)
+            {
+                // j = 0 is the oldest sample; distance from the interpolated point
+                const float t      = static_cast<float> (j) - (half - 1.0f) - frac;
+                const float sinc   = std::abs (t) < 1.0e-6f ? 1.0f
+                                       : std::sin (juce::MathConstants<float>::pi * t)
+                                         / (juce::MathConstants<float>::pi * t);
+                const float window = 0.5f * (1.0f + std::cos (juce::MathConstants<float>::pi * t / half));
+                truePeakCoeffs[p][j] = sinc * window;
+                sum += truePeakCoeffs[p][j];
+            }
+
+            // Unity DC gain per phase; track the worst-case |gain| for the fast-path bound
+            float absSum = 0.0f;
+            for (int j = 0; j < truePeakTaps; ++j)
+            {
+                truePeakCoeffs[p][j] /= sum;
+                absSum += std::abs (truePeakCoeffs[p][j]);
+            }
+            worstGain = juce::jmax (worstGain, absSum);
+        }
+
+        truePeakMaxGain = juce::jmax (1.0f, worstGain);
+    }
+
+    /** Returns an upper bound for every inter-sample value this sub-block can produce. */
+    float pushTruePeakHistory (const juce::AudioBuffer<float>& buffer, int chCount, int start, int length)
+    {
+        float peak = 0.0f;
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            float* hist = truePeakHistory.getWritePointer (ch);
+            juce::FloatVectorOperations::copy (hist + truePeakTaps - 1, buffer.getReadPointer (ch, start), length);
+
+            const auto range = juce::FloatVectorOperations::findMinAndMax (hist, truePeakTaps - 1 + length);
+            peak = juce::jmax (peak, -range.getStart(), range.getEnd());
+        }
+        return peak * truePeakMaxGain;
+    }
+
+    /** Keep the last (taps - 1) samples at the front for the next sub-block. */
+    void carryTruePeakHistory (int chCount, int length)
+    {
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            float* hist = truePeakHistory.getWritePointer (ch);
+            std::memmove (hist, hist + length, sizeof (float) * static_cast<size_t> (truePeakTaps - 1));
+        }
+    }
+
+    /** Fold the three in-between phases of every sample into the linked detector levels. */
+    void accumulateInterSamplePeaks (float* levels, int chCount, int length)
+    {
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            const float* hist = truePeakHistory.getReadPointer (ch);
+
+            for (int i = 0; i < length; ++i)
+            {
+                const float* window = hist + i;  // x[n - taps + 1 .. n] for n = sample i
+                float peak = levels[i];
+
+                for (int p = 0; p < truePeakPhases; ++p)
+                {
+                    float acc = 0.0f;
+                    for (int j = 0; j < truePeakTaps; ++j)
+                        acc += window[j] * truePeakCoeffs[p][j];
+                    peak = juce::jmax (peak, std::abs (acc));
+                }
+
+                levels[i] = peak;
+            }
+        }
+    }
+
+    /** Write the sub-block into the ring and replace it with audio from `lookahead` samples ago. */
+    void delaySubBlock (juce::AudioBuffer<float>& buffer, int chCount, int start, int length)
+    {
+        if (lookaheadSamples == 0)
+            return;
+
+        const int ringSize = ringMask + 1;
+        const int readPos  = (writePos - lookaheadSamples + ringSize) & ringMask;
+
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            float* data = buffer.getWritePointer (ch, start);
+            float* ring = delayLine.getWritePointer (ch);
+
+            const int writeFirst = juce::jmin (length, ringSize - writePos);
+            juce::FloatVectorOperations::copy (ring + writePos, data, writeFirst);
+            juce::FloatVectorOperations::copy (ring, data + writeFirst, length - writeFirst);
+
+            const int readFirst = juce::jmin (length, ringSize - readPos);
+            juce::FloatVectorOperations::copy (data, ring + readPos, readFirst);
+            juce::FloatVectorOperations::copy (data + readFirst, ring, length - readFirst);
+        }
+
+        writePos = (writePos + length) & ringMask;
+    }
+
+    void applyGainRamp (juce::AudioBuffer<float>& buffer, int chCount, int start, int length,
+                        float startGain, float endGain)
+    {
+        if (startGain >= 1.0f && endGain >= 1.0f)
+            return;
+
+        const bool isRamp = startGain != endGain;
+        if (isRamp)
+        {
+            const float step = (endGain - startGain) / static_cast<float> (length);
+            for (int i = 0; i < length; ++i)
+                gainScratch[i] = startGain + step * static_cast<float> (i + 1);
+        }
+
+        for (int ch = 0; ch < chCount; ++ch)
+        {
+            float* data = buffer.getWritePointer (ch, start);
+
+            if (isRamp)
+                juce::FloatVectorOperations::multiply (data, gainScratch, length);
+            else
+                juce::FloatVectorOperations::multiply (data, startGain, length);
+
+            // Rounding guard only — the gain already satisfies the ceiling
+            juce::FloatVectorOperations::clip (data, data, -threshold, threshold, length);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    static constexpr int minSubBlockSize = 16;
+    static constexpr int maxSubBlockSize = 64;
+
+    float threshold   = 1.0f;   // 0 dBFS brickwall
+    float lookaheadMs = 1.0f;   // default lookahead: 1 ms
+    float releaseMs   = 50.0f;  // 50ms release — transparent for mixing use
+
+    double sampleRate       = 44100.0;
+    int    numChannels      = 2;
+    int    lookaheadSamples = 0;
+    int    subBlockSize     = maxSubBlockSize;
+    float  releaseCoeff     = 0.0f;
+
+    // Lookahead delay: one power-of-two ring per channel, shared write position
+    juce::AudioBuffer<float> delayLine;
+    int ringMask = 0;
+    int writePos = 0;
+
+    // Detector
+    SlidingWindowMax peakWindow;
+    bool  detectorIdle = true;
+    float gain         = 1.0f;   // gain at the end of the last sub-block
+    float lowestGain   = 1.0f;   // minimum ramp endpoint in the last process() call
+
+    // Per-sub-block scratch (fixed size — no allocation in process())
+    float levelScratch[maxSubBlockSize] {};
+    float gainScratch [maxSubBlockSize] {};
+
+    // True-peak interpolator (4x: three in-between phases, the fourth is the sample itself)
+    static constexpr int truePeakTaps   = 12;
+    static constexpr int truePeakPhases = 3;
+
+    // Phase p (1..3) of x[n - taps + 1 .. n] sits at n - taps/2 + p/4: a group delay of
+    // 5.25–5.75 samples, between x[n - 6] and x[n - 5]. Lateness of a detected peak
+    // relative to its older neighbour — what the lookahead has to cover:
+    static constexpr int truePeakDelaySamples = truePeakTaps / 2;
+
+    bool  truePeak        = false;
+    float truePeakMaxGain = 1.0f;
+    float truePeakCoeffs[truePeakPhases][truePeakTaps] {};
+    juce::AudioBuffer<float> truePeakHistory;   // per channel: [taps - 1 history | sub-block]
 };
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <array>
+#include <juce_core/juce_core.h>
+
+/**
+ * QualityGovernor — opt-in CPU-load-adaptive quality (Adaptive Quality parameter).
+ *
+ * The processor reports the wall-clock time of every processBlock() with the block's
+ * length; load = time / real-time budget (numSamples / sampleRate). Loads are pooled
+ * into windows of Settings::windowSeconds of audio, and each window is judged two ways:
+ *
+ *   absolute  the instance's own share of the budget (mean, worst block) — catches a
+ *             heavy instance on its own
+ *   relative  the window mean against this tier's baseline, the instance's uncontended
+ *             cost — catches session-wide pressure, which shows up as the same work
+ *             taking longer (preemption, shared caches, throttling) long before one
+ *             instance among dozens reaches an absolute threshold
+ *
+ * A window is under pressure if either test says so, and has headroom only if both do:
+ *
+ *   windowsToStepDown pressured windows in a row      → one tier down
+ *   windowsToStepUp   windows with headroom in a row  → one tier up
+ *
+ * Anything in between resets both runs, so the tier holds inside the hysteresis band.
+ * The absolute step-up thresholds sit under half the step-down ones: one tier up roughly
+ * doubles the oversampled work, which must not land straight back in the pressure band.
+ * The window after a change is discarded — it holds the engine's rate crossfade, which
+ * runs both rates at once.
+ *
+ * Baselines are kept per tier as a floor tracker: a faster window lowers the baseline at
+ * once, a slower one raises it by baselineRise per window, so a genuinely heavier setting
+ * (another clip type, the gate) is absorbed in seconds while a contention spike is not.
+ * A tier entered for the first time starts from the tier above × tierCostRatio (half the
+ * oversampled work) — its own windows arrive under pressure and would overstate it.
+ *
+ * Tier n = n oversampling steps below the selected factor (2x is the floor). The engine
+ * crossfades between rates and pads the lower rate to the selected factor's latency
+ * (ClaymoreEngine::setLatencyReference), so a tier change is glitch-free and the
+ * latency reported to the host never moves.
+ *
+ * Audio thread only; no allocation.
+ */
+class QualityGovernor
+{
+public:
+    /** Thresholds and timing; loads are fractions of the real-time budget. */
+    struct Settings
+    {
+        // Windows of 250 ms: down after 0.5 s of pressure, up after 2 s of headroom
+        double windowSeconds     = 0.25;
+        int    windowsToStepDown = 2;
+        int    windowsToStepUp   = 8;
+
+        // Absolute: this instance's share of the budget
+        double stepDownMeanLoad = 0.5;
+        double stepDownPeakLoad = 0.85;
+        double stepUpMeanLoad   = 0.2;
+        double stepUpPeakLoad   = 0.4;
+
+        // Relative: window mean / this tier's baseline. Below minRelativeLoad an instance
+        // costs too little for a lower rate to give anything back
+        double stepDownBaselineRatio = 2.0;
+        double stepUpBaselineRatio   = 1.25;
+        double minRelativeLoad       = 0.005;
+
+        // Baseline tracking
+        double baselineRise  = 0.01;   // fraction of the gap closed per slower window
+        double tierCostRatio = 0.5;    // first estimate of a tier from the one above
+    };
+
+    void setSettings (const Settings& newSettings)
+    {
+        settings = newSettings;
+        prepare (sampleRate);
+    }
+
+    const Settings& getSettings() const { return settings; }
+
+    void prepare (double newSampleRate)
+    {
+        sampleRate    = newSampleRate;
+        windowSamples = juce::jmax (1, juce::roundToInt (sampleRate * settings.windowSeconds));
+        reset();
+    }
+
+    /** Back to full quality with an empty window and no baselines (prepare, or while off). */
+    void reset()
+    {
+        tier             = 0;
+        pressuredWindows = 0;
+        headroomWindows  = 0;
+        discardWindow    = false;
+        baselines.fill (0.0);
+        clearWindow();
+    }
+
+    /**
+     * Deepest tier allowed — the selected oversampling index, so 2x is never undercut.
+     * A different selection changes what every tier costs: the baselines start over.
+     */
+    void setMaxTier (int newMaxTier)
+    {
+        newMaxTier = juce::jlimit (0, maxTiers - 1, newMaxTier);
+        if (newMaxTier == maxTier)
+            return;
+
+        maxTier = newMaxTier;
+        tier    = juce::jmin (tier, maxTier);
+        baselines.fill (0.0);
+    }
+
+    /** Oversampling steps below the selected factor. */
+    int getTier() const { return tier; }
+
+    /** Mean load of the last complete window (fraction of the real-time budget). */
+    double getLastLoad() const { return lastMeanLoad; }
+
+    /** Uncontended mean load of the current tier (0 = not measured yet). */
+    double getBaseline() const { return baselines[static_cast<size_t> (tier)]; }
+
+    /**
+     * Adds one processBlock(): its wall-clock ticks and length in samples.
+     * Returns true if the tier changed (the caller applies it from the next block).
+     */
+    bool addBlock (juce::int64 ticks, int numSamples)
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return false;
+
+        return addLoad (juce::Time::highResolutionTicksToSeconds (ticks), numSamples);
+    }
+
+    /** addBlock() with the callback time in seconds. */
+    bool addLoad (double seconds, int numSamples)
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return false;
+
+        const double budget = numSamples / sampleRate;
+
+        windowBusySeconds   += seconds;
+        windowBudgetSeconds += budget;
+        windowPeakLoad       = juce::jmax (windowPeakLoad, seconds / budget);
+        windowSampleCount   += numSamples;
+
+        if (windowSampleCount < windowSamples)
+            return false;
+
+        const double meanLoad = windowBusySeconds / windowBudgetSeconds;
+        const double peakLoad = windowPeakLoad;
+        lastMeanLoad = meanLoad;
+        clearWindow();
+
+        if (discardWindow)
+        {
+            discardWindow = false;
+            return false;
+        }
+
+        auto& baseline = baselines[static_cast<size_t> (tier)];
+        const double ratio = baseline > 0.0 ? meanLoad / baseline : 1.0;
+        updateBaseline (baseline, meanLoad);
+
+        const bool absolutePressure = meanLoad > settings.stepDownMeanLoad || peakLoad > settings.stepDownPeakLoad;
+        const bool relativePressure = meanLoad >= settings.minRelativeLoad && ratio > settings.stepDownBaselineRatio;
+        const bool headroom         = meanLoad < settings.stepUpMeanLoad && peakLoad < settings.stepUpPeakLoad
+                                        && ratio < settings.stepUpBaselineRatio;
+
+        if (absolutePressure || relativePressure)
+        {
+            headroomWindows  = 0;
+            pressuredWindows = juce::jmin (pressuredWindows + 1, settings.windowsToStepDown);
+
+            if (pressuredWindows == settings.windowsToStepDown && tier < maxTier)
+                return changeTier (tier + 1);
+        }
+        else if (headroom)
+        {
+            pressuredWindows = 0;
+            headroomWindows  = juce::jmin (headroomWindows + 1, settings.windowsToStepUp);
+
+            if (headroomWindows == settings.windowsToStepUp && tier > 0)
+                return changeTier (tier - 1);
+        }
+        else
+        {
+            pressuredWindows = 0;
+            headroomWindows  = 0;
+        }
+
+        return false;
+    }
+
+private:
+    // 8x → 4x → 2x
+    static constexpr int maxTiers = 3;
+
+    void updateBaseline (double& baseline, double meanLoad) const
+    {
+        if (baseline <= 0.0 || meanLoad < baseline)
+            baseline = meanLoad;
+        else
+            baseline += (meanLoad - baseline) * settings.baselineRise;
+    }
+
+    bool changeTier (int newTier)
+    {
+        // First visit below: estimate from this tier rather than learn under pressure
+        auto& next = baselines[static_cast<size_t> (newTier)];
+        if (newTier > tier && next <= 0.0)
+            next = baselines[static_cast<size_t> (tier)] * settings.tierCostRatio;
+
+        tier             = newTier;
+        pressuredWindows = 0;
+        headroomWindows  = 0;
+        discardWindow    = true;
+        return true;
+    }
+
+    void clearWindow()
+    {
+        windowBusySeconds   = 0.0;
+        windowBudgetSeconds = 0.0;
+        windowPeakLoad      = 0.0;
+        windowSampleCount   = 0;
+    }
+
+    Settings settings;
+
+    double sampleRate    = 44100.0;
+    int    windowSamples = 11025;
+
+    int  tier             = 0;
+    int  maxTier          = 0;
+    int  pressuredWindows = 0;
+    int  headroomWindows  = 0;
+    bool discardWindow    = false;
+
+    std::array<double, maxTiers> baselines {};
+
+    // Current window
+    double windowBusySeconds   = 0.0;
+    double windowBudgetSeconds = 0.0;
+    double windowPeakLoad      = 0.0;
+    int    windowSampleCount   = 0;
+
+    double lastMeanLoad = 0.0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include <juce_core/juce_core.h>
+
+/**
+ * Sliding-window maximum over the last N samples — O(1) amortized per sample.
+ *
+ * Monotonic deque: each new sample evicts every older entry that is not larger
+ * than it (those can never be the maximum again), and the front is dropped once
+ * it falls out of the window. The front is therefore always the window maximum.
+ * Each sample is pushed and popped at most once, regardless of window length.
+ *
+ * Storage is a power-of-two ring allocated in prepare(); process() never allocates.
+ * The window length can change at any time (up to the prepared maximum) — shrinking
+ * it simply drops expired entries on the next call.
+ *
+ * Used by the lookahead gate detector (ClaymoreEngine) and OutputLimiter.
+ */
+class SlidingWindowMax
+{
+public:
+    void prepare (int maxWindowLength)
+    {
+        maxLength = juce::jmax (1, maxWindowLength);
+
+        // Deque holds at most maxLength + 1 entries between push and front eviction
+        const int capacity = juce::nextPowerOfTwo (maxLength + 1);
+        values.assign    (static_cast<size_t> (capacity), 0.0f);
+        positions.assign (static_cast<size_t> (capacity), 0);
+        mask = static_cast<size_t> (capacity - 1);
+
+        windowLength = juce::jmin (windowLength, maxLength);
+        reset();
+    }
+
+    void reset()
+    {
+        head = tail = 0;
+        sampleIndex = 0;
+    }
+
+    /** Window length in samples, including the current sample (1 = no lookback). */
+    void setWindowLength (int numSamples) { windowLength = juce::jlimit (1, maxLength, numSamples); }
+    int  getWindowLength() const          { return windowLength; }
+
+    /** Push one sample and return the maximum of the last windowLength samples. */
+    float process (float x)
+    {
+        // Evict entries that can never be the maximum again
+        while (tail != head && values[(tail - 1) & mask] <= x)
+            --tail;
+
+        values[tail & mask]    = x;
+        positions[tail & mask] = sampleIndex;
+        ++tail;
+
+        // Drop the front once it has left the window
+        while (positions[head & mask] <= sampleIndex - windowLength)
+            ++head;
+
+        ++sampleIndex;
+        return values[head & mask];
+    }
+
+private:
+    std::vector<float>       values;
+    std::vector<juce::int64> positions;
+    size_t mask = 0;
+    size_t head = 0;
+    size_t tail = 0;
+
+    juce::int64 sampleIndex = 0;
+    int maxLength    = 1;
+    int windowLength = 1;
+};
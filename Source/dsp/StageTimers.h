@@ -0,0 +1,324 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <juce_core/juce_core.h>
+#include "AudioTrace.h"
+
+// Per-stage timing of the audio callback is a development build option (CMake
+// CLAYMORE_STAGE_TIMERS, and CLAYMORE_TRACE for AudioTrace capture); without either,
+// every Clock call below is an empty inline function.
+#ifndef CLAYMORE_STAGE_TIMERS
+ #define CLAYMORE_STAGE_TIMERS 0
+#endif
+
+#define CLAYMORE_STAGE_CLOCK (CLAYMORE_STAGE_TIMERS || CLAYMORE_TRACE)
+
+/**
+ * Hot-path stage timers: audio thread → editor's timing overlay.
+ *
+ * A Clock splits the time between consecutive lap() calls into the Stage that just ran,
+ * accumulating into one Frame per host block (tiles add up). Time that belongs to no
+ * stage — parameter snapshots, tiling, metering and analyzer taps — is dropped with
+ * skip() and shows up as "other" (callback total minus the stages).
+ *
+ * The processor publishes each Frame through a wait-free SPSC ring (AbstractFifo), as
+ * Metering does; the editor drains it into per-stage Histograms on the message thread.
+ * Nothing is timed while no overlay is showing (setActive), and with the build option
+ * off nothing is timed at all and the ring is not compiled in (the overlay neither).
+ *
+ * The same laps (plus the whole callback and mark()ed events such as parameter changes)
+ * also go to an AudioTrace when one is attached, for a Chrome trace of the session.
+ *
+ * Ticks come from juce::Time::getHighResolutionTicks() — the counter the engine already
+ * uses for oversampling switch load (TSC-backed on current x86 and Apple platforms).
+ */
+class StageTimers
+{
+public:
+    enum class Stage : int
+    {
+        input,        // input gain
+        gate,         // noise gate (both halves of the lookahead gate)
+        upsample,
+        shape,        // FuzzCore per-sample loop (+ the rate-switch crossfade)
+        downsample,
+        tone,
+        mix,          // dry capture + wet/dry blend
+        outputGain,
+        limiter
+    };
+
+    static constexpr int numStages = static_cast<int> (Stage::limiter) + 1;
+
+    static const char* getStageName (int stage)
+    {
+        static constexpr const char* names[numStages]
+            { "input", "gate", "upsample", "shape", "downsample", "tone", "mix", "output", "limiter" };
+        return names[stage];
+    }
+
+    /** One host block: ticks per stage, the whole callback, and the block's real-time budget. */
+    struct Frame
+    {
+        std::array<juce::int64, numStages> stageTicks {};
+        juce::int64 callbackTicks = 0;
+        int         numSamples    = 0;
+        double      sampleRate    = 0.0;
+    };
+
+    //==========================================================================
+    /**
+     * Lap timer for the audio thread, feeding a Frame (overlay), an AudioTrace (capture),
+     * both or neither. With neither attached every call is a single branch.
+     */
+    class Clock
+    {
+    public:
+       #if CLAYMORE_STAGE_CLOCK
+        void start (Frame* frameToFill, AudioTrace* traceToFill = nullptr)
+        {
+            frame = frameToFill;
+            trace = traceToFill;
+            running = frame != nullptr || trace != nullptr;
+
+            if (running)
+                startTicks = lastTicks = now();
+        }
+
+        void lap (Stage stage)
+        {
+            if (! running)
+                return;
+
+            const auto ticks = now();
+
+            if (frame != nullptr)
+                frame->stageTicks[static_cast<size_t> (stage)] += ticks - lastTicks;
+
+            if (trace != nullptr)
+                trace->push ({ getStageName (static_cast<int> (stage)), "stage", lastTicks, ticks });
+
+            lastTicks = ticks;
+        }
+
+        void skip()
+        {
+            if (running)
+                lastTicks = now();
+        }
+
+        /** Instant trace event (parameter change, rate switch, ...); literals only. */
+        void mark (const char* name, const char* argName0 = nullptr, double arg0 = 0.0,
+                   const char* argName1 = nullptr, double arg1 = 0.0)
+        {
+            if (trace != nullptr)
+            {
+                const auto ticks = now();
+                trace->push ({ name, "event", ticks, ticks, { argName0, argName1 }, { arg0, arg1 } });
+            }
+        }
+
+        void stop (int numSamples, double sampleRate)
+        {
+            if (! running)
+                return;
+
+            const auto ticks = now();
+
+            if (frame != nullptr)
+            {
+                frame->callbackTicks = ticks - startTicks;
+                frame->numSamples    = numSamples;
+                frame->sampleRate    = sampleRate;
+            }
+
+            if (trace != nullptr)
+                trace->push ({ "processBlock", "callback", startTicks, ticks, { "samples", "sampleRate" },
+                               { static_cast<double> (numSamples), sampleRate } });
+
+            frame   = nullptr;
+            trace   = nullptr;
+            running = false;
+        }
+       #else
+        void start (Frame*, AudioTrace* = nullptr) {}
+        void lap (Stage)                           {}
+        void skip()                                {}
+        void mark (const char*, const char* = nullptr, double = 0.0, const char* = nullptr, double = 0.0) {}
+        void stop (int, double)                    {}
+       #endif
+
+   #if CLAYMORE_STAGE_CLOCK
+    private:
+        static juce::int64 now() { return AudioTrace::now(); }
+
+        Frame*      frame      = nullptr;
+        AudioTrace* trace      = nullptr;
+        bool        running    = false;
+        juce::int64 startTicks = 0;
+        juce::int64 lastTicks  = 0;
+   #endif
+    };
+
+    //==========================================================================
+    /**
+     * Log-spaced histograms of per-callback µs, one per stage plus "other" and the
+     * callback total (message thread only). 24 bins per decade from 0.01 µs to 100 ms:
+     * percentiles are within ~10%, means are exact.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr int other = numStages;
+        static constexpr int total = numStages + 1;
+        static constexpr int numRows = numStages + 2;
+
+        void add (const Frame& frame)
+        {
+            juce::int64 stageSum = 0;
+            for (int stage = 0; stage < numStages; ++stage)
+            {
+                addValue (stage, toMicroseconds (frame.stageTicks[static_cast<size_t> (stage)]));
+                stageSum += frame.stageTicks[static_cast<size_t> (stage)];
+            }
+
+            addValue (other, toMicroseconds (juce::jmax (juce::int64 { 0 }, frame.callbackTicks - stageSum)));
+            addValue (total, toMicroseconds (frame.callbackTicks));
+
+            if (frame.sampleRate > 0.0)
+                budgetMicroseconds += 1.0e6 * frame.numSamples / frame.sampleRate;
+            ++numCallbacks;
+        }
+
+        void clear()
+        {
+            for (auto& row : rows)
+                row = {};
+            budgetMicroseconds = 0.0;
+            numCallbacks = 0;
+        }
+
+        int getNumCallbacks() const { return numCallbacks; }
+
+        double getMean (int row) const
+        {
+            return numCallbacks > 0 ? rows[static_cast<size_t> (row)].sum / numCallbacks : 0.0;
+        }
+
+        /** Upper edge of the bin holding the given fraction of callbacks (0.99 = p99). */
+        double getPercentile (int row, double fraction) const
+        {
+            const auto& bins = rows[static_cast<size_t> (row)].bins;
+            const auto target = static_cast<juce::int64> (std::ceil (fraction * numCallbacks));
+
+            juce::int64 count = 0;
+            for (int bin = 0; bin < numBins; ++bin)
+            {
+                count += bins[static_cast<size_t> (bin)];
+                if (count >= juce::jmax (juce::int64 { 1 }, target))
+                    return minMicroseconds * std::pow (10.0, (bin + 1) / static_cast<double> (binsPerDecade));
+            }
+            return 0.0;
+        }
+
+        /** Mean share of the real-time budget (block length) the row used, in percent. */
+        double getBudgetPercent (int row) const
+        {
+            return budgetMicroseconds > 0.0 ? 100.0 * rows[static_cast<size_t> (row)].sum / budgetMicroseconds : 0.0;
+        }
+
+        static const char* getRowName (int row)
+        {
+            return row == other ? "other" : (row == total ? "callback" : getStageName (row));
+        }
+
+    private:
+        static constexpr int    binsPerDecade   = 24;
+        static constexpr int    numBins         = 7 * binsPerDecade;
+        static constexpr double minMicroseconds = 0.01;
+
+        struct Row
+        {
+            std::array<juce::int64, numBins> bins {};
+            double sum = 0.0;
+        };
+
+        static double toMicroseconds (juce::int64 ticks)
+        {
+            return 1.0e6 * juce::Time::highResolutionTicksToSeconds (ticks);
+        }
+
+        void addValue (int row, double microseconds)
+        {
+            auto& r = rows[static_cast<size_t> (row)];
+            r.sum += microseconds;
+
+            const int bin = microseconds > minMicroseconds
+                                ? static_cast<int> (std::log10 (microseconds / minMicroseconds) * binsPerDecade)
+                                : 0;
+            ++r.bins[static_cast<size_t> (juce::jlimit (0, numBins - 1, bin))];
+        }
+
+        std::array<Row, numRows> rows {};
+        double budgetMicroseconds = 0.0;
+        int    numCallbacks       = 0;
+    };
+
+    // --- Audio thread ---
+
+    /** True while the overlay is showing (always false when the build option is off). */
+    bool isActive() const
+    {
+       #if CLAYMORE_STAGE_TIMERS
+        return active.load (std::memory_order_relaxed);
+       #else
+        return false;
+       #endif
+    }
+
+    /** Publishes one frame. Wait-free; drops the frame if the ring is full. */
+    void push (const Frame& frame)
+    {
+       #if CLAYMORE_STAGE_TIMERS
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 > 0)
+            frames[static_cast<size_t> (scope.startIndex1)] = frame;
+       #else
+        juce::ignoreUnused (frame);
+       #endif
+    }
+
+    // --- Editor (message thread) ---
+
+    static constexpr bool isCompiledIn() { return CLAYMORE_STAGE_TIMERS != 0; }
+
+    // Without the build option the ring (~50 KB per instance) is not compiled in: the
+    // class is empty, the audio-thread calls above are no-ops and there is no overlay
+   #if CLAYMORE_STAGE_TIMERS
+    /** Start/stop publishing. Frames left over from an earlier session are discarded on start. */
+    void setActive (bool shouldBeActive)
+    {
+        if (shouldBeActive)
+            fifo.read (fifo.getNumReady());   // the scope's destructor frees the slots
+
+        active.store (shouldBeActive, std::memory_order_relaxed);
+    }
+
+    /** Adds every pending frame to the histogram. */
+    void drainInto (Histogram& histogram)
+    {
+        const auto scope = fifo.read (fifo.getNumReady());
+        scope.forEach ([&] (int index) { histogram.add (frames[static_cast<size_t> (index)]); });
+    }
+
+private:
+    // Same depth as Metering: ~340 ms of 32-sample blocks at 48 kHz
+    static constexpr int capacity = 512;
+
+    juce::AbstractFifo          fifo { capacity };
+    std::array<Frame, capacity> frames {};
+    std::atomic<bool>           active { false };
+   #endif
+};
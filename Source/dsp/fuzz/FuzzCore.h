@@ -62,30 +62,12 @@ struct FuzzCoreState
 namespace FuzzCore
 {
     /**
-     * Rat-based waveshaping with selectable clipping circuit and sag.
-     *
-     * @param x           Input sample
-     * @param drive       Mapped drive gain (1-40x)
-     * @param clipType    Clipping circuit index (ClipType enum cast to int)
-     * @param sag         0 = no sag, 1 = heavy sputter (dying battery)
-     * @param state       Per-channel state (slew filter, tightness filter, envelope)
+     * Memoryless clipping circuit: maps the slewed, driven signal through one of the
+     * 8 ClipType curves. Germanium and Asymmetric add a bias from the envelope follower
+     * (0 = no bias, the static curve).
      */
-    inline float processSample (float x, float drive, int clipType, float sag,
-                                FuzzCoreState& state)
+    inline float clipSample (float slewed, int clipType, float envelope)
     {
-        // Tightness filter: HP before gain (cutoff set externally by ClaymoreEngine)
-        x = state.tightnessFilter.processSample (0, x);
-
-        // Apply drive gain
-        const float gained = x * drive;
-
-        // Slew rate limiting: LM308 character
-        // Cutoff decreases with drive for more "thickness" at high gain
-        const float slewCutoff = 3000.0f * (1.0f - (drive - 1.0f) / 78.0f);
-        state.slewFilter.setCutoffFrequency (juce::jmax (1500.0f, slewCutoff));
-        const float slewed = state.slewFilter.processSample (0, gained);
-
-        // --- Clipping circuit ---
         float clipped = 0.0f;
 
         switch (static_cast<ClipType> (clipType))
@@ -101,16 +83,7 @@ namespace FuzzCore
             case ClipType::Germanium:
             {
                 // Soft clip ±0.3 V with envelope bias — warm, compressed, vintage
-                const float absInput     = std::abs (x);
-                constexpr float atkCoeff = 0.01f;
-                constexpr float relCoeff = 0.001f;
-
-                if (absInput > state.envelopeValue)
-                    state.envelopeValue += atkCoeff * (absInput - state.envelopeValue);
-                else
-                    state.envelopeValue += relCoeff * (absInput - state.envelopeValue);
-
-                const float biased = slewed + state.envelopeValue * 0.8f;
+                const float biased = slewed + envelope * 0.8f;
                 clipped = biased / (1.0f + std::abs (biased));
                 break;
             }
@@ -133,15 +106,6 @@ namespace FuzzCore
             case ClipType::Asymmetric:
             {
                 // +0.6 V / −0.3 V mixed diodes — even harmonics, gritty (Dirty Rat)
-                const float absInput     = std::abs (x);
-                constexpr float atkCoeff = 0.01f;
-                constexpr float relCoeff = 0.001f;
-
-                if (absInput > state.envelopeValue)
-                    state.envelopeValue += atkCoeff * (absInput - state.envelopeValue);
-                else
-                    state.envelopeValue += relCoeff * (absInput - state.envelopeValue);
-
                 constexpr float thPos = 0.6f;
                 constexpr float thNeg = 0.3f;
                 if (slewed > 0.0f)
@@ -150,7 +114,7 @@ namespace FuzzCore
                     clipped = juce::jmax (slewed, -thNeg) / thNeg;
 
                 // Subtle envelope bias for touch sensitivity
-                clipped += state.envelopeValue * 0.15f;
+                clipped += envelope * 0.15f;
                 clipped = juce::jlimit (-1.0f, 1.0f, clipped);
                 break;
             }
@@ -200,24 +164,88 @@ namespace FuzzCore
             }
         }
 
-        // --- Sag: bias-starve sputter ---
-        if (sag > 0.0f)
+        return clipped;
+    }
+
+    /** Sag: bias-starve sputter below a sag-dependent threshold, then gain-neutral makeup. */
+    inline float applySag (float clipped, float sag)
+    {
+        if (sag <= 0.0f)
+            return clipped;
+
+        const float sagThreshold = 0.3f * sag;
+        const float absClipped   = std::abs (clipped);
+
+        if (absClipped < sagThreshold)
         {
-            const float sagThreshold = 0.3f * sag;
-            const float absClipped   = std::abs (clipped);
+            // Below threshold: exponential decay for dying-battery character
+            const float ratio = absClipped / juce::jmax (sagThreshold, 0.001f);
+            clipped = clipped * ratio * ratio;
+        }
 
-            if (absClipped < sagThreshold)
-            {
-                // Below threshold: exponential decay for dying-battery character
-                const float ratio = absClipped / juce::jmax (sagThreshold, 0.001f);
-                clipped = clipped * ratio * ratio;
-            }
+        // Gain-neutral makeup: compensate for level reduction at high sag
+        const float sagMakeup = 1.0f + sag * 0.5f;
+        return clipped * sagMakeup;
+    }
 
-            // Gain-neutral makeup: compensate for level reduction at high sag
-            const float sagMakeup = 1.0f + sag * 0.5f;
-            clipped *= sagMakeup;
+    /**
+     * Rat-based waveshaping with selectable clipping circuit and sag.
+     *
+     * @param x           Input sample
+     * @param drive       Mapped drive gain (1-40x)
+     * @param clipType    Clipping circuit index (ClipType enum cast to int)
+     * @param sag         0 = no sag, 1 = heavy sputter (dying battery)
+     * @param state       Per-channel state (slew filter, tightness filter, envelope)
+     */
+    inline float processSample (float x, float drive, int clipType, float sag,
+                                FuzzCoreState& state)
+    {
+        // Tightness filter: HP before gain (cutoff set externally by ClaymoreEngine)
+        x = state.tightnessFilter.processSample (0, x);
+
+        // Apply drive gain
+        const float gained = x * drive;
+
+        // Slew rate limiting: LM308 character
+        // Cutoff decreases with drive for more "thickness" at high gain
+        const float slewCutoff = 3000.0f * (1.0f - (drive - 1.0f) / 78.0f);
+        state.slewFilter.setCutoffFrequency (juce::jmax (1500.0f, slewCutoff));
+        const float slewed = state.slewFilter.processSample (0, gained);
+
+        // Envelope follower on the (tightened) input: bias for Germanium / Asymmetric
+        const auto type = static_cast<ClipType> (clipType);
+        if (type == ClipType::Germanium || type == ClipType::Asymmetric)
+        {
+            const float absInput     = std::abs (x);
+            constexpr float atkCoeff = 0.01f;
+            constexpr float relCoeff = 0.001f;
+
+            if (absInput > state.envelopeValue)
+                state.envelopeValue += atkCoeff * (absInput - state.envelopeValue);
+            else
+                state.envelopeValue += relCoeff * (absInput - state.envelopeValue);
         }
 
-        return clipped;
+        // --- Clipping circuit ---
+        const float clipped = clipSample (slewed, clipType, state.envelopeValue);
+
+        // --- Sag: bias-starve sputter ---
+        return applySag (clipped, sag);
+    }
+
+    /**
+     * Static transfer curve of the shaper for display: output = applySag (clipSample
+     * (input * drive)) for a whole array in one call. Uses the same clip and sag code as
+     * processSample(), but no FuzzCoreState: the slew and tightness filters and the
+     * envelope bias are signal-dependent and are left out (envelope = 0).
+     * Safe on any thread.
+     */
+    inline void processTransferCurve (const float* input, float* output, int numSamples,
+                                      float drive, int clipType, float sag)
+    {
+        juce::FloatVectorOperations::multiply (output, input, drive, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = applySag (clipSample (output[i], clipType, 0.0f), sag);
     }
 }
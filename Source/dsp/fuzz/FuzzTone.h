@@ -11,6 +11,7 @@
  * DC blocker: 20 Hz high-pass IIR after all tone processing
  *
  * SmoothedValue for tone and presence (5ms ramp) to prevent zipper noise.
+ * Filter parameters are only recomputed while those smoothers move.
  *
  * Based on GunkLord FuzzTone.h — one change: Tone LP range 2000–20000 Hz
  * (line marked with "CLAYMORE CHANGE" comment).
@@ -21,21 +22,29 @@ public:
     void prepare (const juce::dsp::ProcessSpec& spec)
     {
         sampleRate  = spec.sampleRate;
-        numChannels = static_cast<int> (spec.numChannels);
+        numChannels = juce::jmin (maxChannels, static_cast<int> (spec.numChannels));
 
         // Rat tone filter
         ratToneFilter.prepare (spec);
         ratToneFilter.setType (juce::dsp::FirstOrderTPTFilterType::lowpass);
 
-        // Presence high-shelf filter
-        presenceFilter.prepare (spec);
+        // Presence high-shelf filter (coefficients shared by all channels)
         updatePresenceCoefficients (0.5f);
 
         // DC blocker: 20 Hz high-pass
-        dcBlocker.prepare (spec);
-        auto dcCoeffs = juce::dsp::IIR::Coefficients<float>::makeFirstOrderHighPass (
+        *dcCoefficients = *juce::dsp::IIR::Coefficients<float>::makeFirstOrderHighPass (
             sampleRate, 20.0f);
-        *dcBlocker.state = *dcCoeffs;
+
+        // Assign shared coefficients before prepare(): Filter::reset() sizes its state
+        // from the coefficient order, so processSample() never reallocates later
+        for (int ch = 0; ch < maxChannels; ++ch)
+        {
+            presenceFilter[ch].coefficients = presenceCoefficients;
+            presenceFilter[ch].prepare (spec);
+
+            dcBlocker[ch].coefficients = dcCoefficients;
+            dcBlocker[ch].prepare (spec);
+        }
 
         // Parameter smoothing: 5ms ramp
         toneSmoother.reset (sampleRate, 0.005);
@@ -43,16 +52,22 @@ public:
 
         presenceSmoother.reset (sampleRate, 0.005);
         presenceSmoother.setCurrentAndTargetValue (0.5f);
+
+        appliedTone = -1.0f;  // force cutoff update on the first sample
     }
 
     void reset()
     {
         ratToneFilter.reset();
-        presenceFilter.reset();
-        dcBlocker.reset();
+        for (int ch = 0; ch < maxChannels; ++ch)
+        {
+            presenceFilter[ch].reset();
+            dcBlocker[ch].reset();
+        }
 
         toneSmoother.setCurrentAndTargetValue (0.5f);
         presenceSmoother.setCurrentAndTargetValue (0.5f);
+        appliedTone = -1.0f;
     }
 
     void setTone    (float tone) { toneSmoother.setTargetValue (tone); }
@@ -61,80 +76,113 @@ public:
     /**
      * Apply Rat tone filtering, presence high-shelf, and DC blocking
      * to the buffer at the original (non-oversampled) sample rate.
+     *
+     * The three filters run fused, per sample, straight on the channel data — no
+     * AudioBlock/ProcessContext wrappers per call. Tone cutoff and presence
+     * coefficients are only recomputed when their smoothed value actually changes;
+     * once both smoothers have settled the filters run channel by channel with no
+     * per-sample parameter work at all.
      */
     void applyTone (juce::AudioBuffer<float>& buffer)
     {
         const int numSamples = buffer.getNumSamples();
         const int chCount    = juce::jmin (numChannels, buffer.getNumChannels());
 
-        // Apply Rat tone circuit
-        for (int sample = 0; sample < numSamples; ++sample)
+        if (toneSmoother.isSmoothing() || presenceSmoother.isSmoothing() || appliedTone < 0.0f)
         {
-            const float tone     = toneSmoother.getNextValue();
-            const float presence = presenceSmoother.getNextValue();
-
-            updatePresenceCoefficients (presence);
-
-            // CLAYMORE CHANGE: Rat tone LP sweep 2000–20000 Hz
-            // (GunkLord original: 800.0f + tone * 7200.0f  →  800–8000 Hz)
-            const float cutoff = 2000.0f + tone * 18000.0f;
-            ratToneFilter.setCutoffFrequency (cutoff);
+            // Ramping: update cutoff/coefficients per sample, channels inner
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                updateParameters (toneSmoother.getNextValue(), presenceSmoother.getNextValue());
 
+                for (int ch = 0; ch < chCount; ++ch)
+                {
+                    float* data = buffer.getWritePointer (ch);
+                    data[sample] = processSample (ch, data[sample]);
+                }
+            }
+        }
+        else
+        {
+            // Settled: coefficients are current — channels outer for locality
             for (int ch = 0; ch < chCount; ++ch)
             {
-                float x = buffer.getSample (ch, sample);
-                x = ratToneFilter.processSample (ch, x);
-                buffer.setSample (ch, sample, x);
+                float* data = buffer.getWritePointer (ch);
+                for (int sample = 0; sample < numSamples; ++sample)
+                    data[sample] = processSample (ch, data[sample]);
             }
         }
 
-        // Apply presence high-shelf (block processing)
+        // Same denormal housekeeping the block-based IIR::Filter::process() did
+        for (int ch = 0; ch < chCount; ++ch)
         {
-            juce::dsp::AudioBlock<float>              block (buffer);
-            juce::dsp::ProcessContextReplacing<float> context (block);
-            presenceFilter.process (context);
+            presenceFilter[ch].snapToZero();
+            dcBlocker[ch].snapToZero();
         }
+    }
 
-        // DC blocker: 20 Hz high-pass
+private:
+    static constexpr int maxChannels = 8;
+
+    /** Rat tone LP → presence high-shelf → 20 Hz DC blocker for one sample. */
+    float processSample (int ch, float x)
+    {
+        x = ratToneFilter.processSample (ch, x);
+        x = presenceFilter[ch].processSample (x);
+        return dcBlocker[ch].processSample (x);
+    }
+
+    void updateParameters (float tone, float presence)
+    {
+        if (presence != appliedPresence)
+            updatePresenceCoefficients (presence);
+
+        if (tone != appliedTone)
         {
-            juce::dsp::AudioBlock<float>              block (buffer);
-            juce::dsp::ProcessContextReplacing<float> context (block);
-            dcBlocker.process (context);
+            appliedTone = tone;
+
+            // CLAYMORE CHANGE: Rat tone LP sweep 2000–20000 Hz
+            // (GunkLord original: 800.0f + tone * 7200.0f  →  800–8000 Hz)
+            const float cutoff = 2000.0f + tone * 18000.0f;
+            ratToneFilter.setCutoffFrequency (cutoff);
         }
     }
 
-private:
     /**
-     * Update presence high-shelf coefficients.
+     * Update presence high-shelf coefficients in place (no allocation — the shared
+     * Coefficients object is overwritten from ArrayCoefficients).
      * Presence 0 = -6 dB cut. Presence 0.5 = flat. Presence 1.0 = +6 dB boost.
      */
     void updatePresenceCoefficients (float presence)
     {
+        appliedPresence = presence;
+
         const float gainDB     = (presence - 0.5f) * 12.0f;
         const float gainLinear = juce::Decibels::decibelsToGain (gainDB);
 
-        auto coeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf (
+        *presenceCoefficients = juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf (
             sampleRate, 4000.0f, 0.707f, gainLinear);
-        *presenceFilter.state = *coeffs;
     }
 
     // Rat tone filter
     juce::dsp::FirstOrderTPTFilter<float> ratToneFilter;
 
-    // Presence high-shelf
-    juce::dsp::ProcessorDuplicator<
-        juce::dsp::IIR::Filter<float>,
-        juce::dsp::IIR::Coefficients<float>> presenceFilter;
+    // Presence high-shelf — one filter per channel sharing presenceCoefficients
+    juce::dsp::IIR::Coefficients<float>::Ptr presenceCoefficients { new juce::dsp::IIR::Coefficients<float> (1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f) };
+    juce::dsp::IIR::Filter<float> presenceFilter[maxChannels];
 
-    // DC blocker: 20 Hz high-pass IIR
-    juce::dsp::ProcessorDuplicator<
-        juce::dsp::IIR::Filter<float>,
-        juce::dsp::IIR::Coefficients<float>> dcBlocker;
+    // DC blocker: 20 Hz high-pass IIR — one filter per channel sharing dcCoefficients
+    juce::dsp::IIR::Coefficients<float>::Ptr dcCoefficients { new juce::dsp::IIR::Coefficients<float> (1.0f, 0.0f, 1.0f, 0.0f) };
+    juce::dsp::IIR::Filter<float> dcBlocker[maxChannels];
 
     // Parameter smoothers (5ms ramp)
     juce::SmoothedValue<float> toneSmoother;
     juce::SmoothedValue<float> presenceSmoother;
 
+    // Last values pushed into the filters (recompute only on change)
+    float appliedTone     = -1.0f;
+    float appliedPresence = -1.0f;
+
     double sampleRate  = 44100.0;
     int    numChannels = 2;
 };
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "../look/ClaymoreTheme.h"
+
+/**
+ * LevelMeter — slim vertical bar fed from Metering::Reading by the editor's vblank timer.
+ *
+ * Level style:          RMS fill from the bottom + peak-hold line, -60..0 dBFS.
+ * Gain-reduction style: reduction fill from the top, 0..24 dB.
+ *
+ * Ballistics run on the message thread (instant attack, linear dB fall). update() only
+ * calls repaint() when a drawn edge moves by at least one pixel, so a steady signal
+ * costs no painting at all, and a moving one repaints just this meter's bounds.
+ */
+class LevelMeter : public juce::Component
+{
+public:
+    enum class Style
+    {
+        level,
+        gainReduction
+    };
+
+    explicit LevelMeter (Style meterStyle = Style::level)
+        : style (meterStyle)
+    {
+        if (style == Style::gainReduction)
+            displayedPeakDB = 0.0f;
+
+        setInterceptsMouseClicks (false, false);
+    }
+
+    /**
+     * Feed one editor frame. peak/rms are linear gains (for gainReduction, both are the
+     * limiter gain); elapsedSeconds drives the fall rate.
+     */
+    void update (float peak, float rms, float elapsedSeconds)
+    {
+        const float fall = fallDBPerSecond * elapsedSeconds;
+
+        if (style == Style::gainReduction)
+        {
+            const float reductionDB = -juce::Decibels::gainToDecibels (peak, -maxReductionDB);
+            displayedPeakDB = juce::jmax (reductionDB, displayedPeakDB - fall, 0.0f);
+        }
+        else
+        {
+            const float peakDB = juce::Decibels::gainToDecibels (peak, floorDB);
+            const float rmsDB  = juce::Decibels::gainToDecibels (rms,  floorDB);
+            displayedPeakDB = juce::jmax (peakDB, displayedPeakDB - fall, floorDB);
+            displayedRmsDB  = juce::jmax (rmsDB,  displayedRmsDB  - fall, floorDB);
+        }
+
+        const auto edges = computeEdges();
+        if (edges != drawnEdges)
+        {
+            drawnEdges = edges;
+            repaint();
+        }
+    }
+
+    void paint (juce::Graphics& g) override
+    {
+        const auto bounds = getLocalBounds().toFloat();
+
+        // Recessed slot
+        g.setColour (juce::Colour (ClaymoreColors::knobBody));
+        g.fillRoundedRectangle (bounds, 1.5f);
+
+        if (style == Style::gainReduction)
+        {
+            g.setColour (juce::Colour (ClaymoreColors::accent));
+            g.fillRect (bounds.withHeight (static_cast<float> (drawnEdges.peak)));
+        }
+        else
+        {
+            const float h = bounds.getHeight();
+
+            g.setColour (juce::Colour (ClaymoreColors::ledActive).withAlpha (0.85f));
+            g.fillRect (bounds.withTop (h - static_cast<float> (drawnEdges.rms)));
+
+            if (drawnEdges.peak > 0)
+            {
+                g.setColour (juce::Colour (ClaymoreColors::indicator));
+                g.fillRect (bounds.withTop (h - static_cast<float> (drawnEdges.peak)).withHeight (1.0f));
+            }
+        }
+
+        // Subtle rim
+        g.setColour (juce::Colour (0x18000000));
+        g.drawRoundedRectangle (bounds, 1.5f, 0.5f);
+    }
+
+private:
+    struct Edges
+    {
+        int peak = 0;
+        int rms  = 0;
+
+        bool operator!= (const Edges& other) const { return peak != other.peak || rms != other.rms; }
+    };
+
+    Edges computeEdges() const
+    {
+        const float h = static_cast<float> (getHeight());
+
+        if (style == Style::gainReduction)
+            return { juce::roundToInt (h * juce::jmin (1.0f, displayedPeakDB / maxReductionDB)), 0 };
+
+        auto toPixels = [&] (float dB) { return juce::roundToInt (juce::jmap (dB, floorDB, 0.0f, 0.0f, h)); };
+        return { toPixels (juce::jmin (displayedPeakDB, 0.0f)), toPixels (juce::jmin (displayedRmsDB, 0.0f)) };
+    }
+
+    static constexpr float floorDB         = -60.0f;
+    static constexpr float maxReductionDB  = 24.0f;
+    static constexpr float fallDBPerSecond = 24.0f;
+
+    Style style;
+    float displayedPeakDB = -60.0f;   // level: dBFS; gainReduction: dB of reduction (>= 0)
+    float displayedRmsDB  = -60.0f;
+    Edges drawnEdges;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LevelMeter)
+};
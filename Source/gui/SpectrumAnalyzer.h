@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+#include <juce_dsp/juce_dsp.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "../AnalyzerFeed.h"
+#include "../look/ClaymoreTheme.h"
+
+/**
+ * SpectrumAnalyzer — pre- vs post-distortion spectra (aliasing check per circuit and
+ * oversampling factor), or an oscilloscope of the engine output. Click to switch.
+ *
+ * Threading:
+ *   - Audio thread: only downmixes samples into AnalyzerFeed (see AnalyzerFeed.h).
+ *   - AnalysisThread (~30 frames/s): drains the feed, Hann window + FFT (juce::dsp::FFT),
+ *     fast-attack/slow-release smoothing, and writes the spectrum and scope points
+ *     (normalised 0..1 heights, preallocated arrays) into its frame of a triple buffer,
+ *     then publishes it by swapping indices — no lock, no allocation on either side.
+ *   - Message thread: a vblank callback repaints only when a new frame was published;
+ *     paint() swaps it in, builds the Paths from its points and scales them to the
+ *     component.
+ *
+ * The component owns the thread and activates the feed: closing the editor stops both,
+ * so the analyzer costs nothing in unattended sessions.
+ */
+class SpectrumAnalyzer : public juce::Component
+{
+public:
+    explicit SpectrumAnalyzer (AnalyzerFeed& feedToUse)
+        : feed (feedToUse), analysis (feedToUse)
+    {
+        feed.setActive (true);
+        analysis.startThread (juce::Thread::Priority::low);
+    }
+
+    ~SpectrumAnalyzer() override
+    {
+        analysis.stopThread (1000);
+        feed.setActive (false);
+    }
+
+    void paint (juce::Graphics& g) override
+    {
+        const auto bounds = getLocalBounds().toFloat();
+
+        // Dark screen recessed into the panel
+        g.setColour (juce::Colour (ClaymoreColors::knobBody));
+        g.fillRoundedRectangle (bounds, 3.0f);
+
+        if (analysis.acquireLatest())
+            buildPaths (analysis.getAcquired());
+
+        const auto screen    = bounds.reduced (3.0f);
+        const auto transform = juce::AffineTransform::scale (screen.getWidth(), screen.getHeight())
+                                                     .translated (screen.getX(), screen.getY());
+
+        g.setColour (juce::Colour (ClaymoreColors::indicator).withAlpha (0.12f));
+        g.strokePath (showScope ? paths.scopeGrid : paths.spectrumGrid,
+                      juce::PathStrokeType (0.5f), transform);
+
+        if (showScope)
+        {
+            g.setColour (juce::Colour (ClaymoreColors::ledActive));
+            g.strokePath (paths.scope, juce::PathStrokeType (1.0f), transform);
+        }
+        else
+        {
+            g.setColour (juce::Colour (ClaymoreColors::indicator).withAlpha (0.45f));
+            g.strokePath (paths.pre, juce::PathStrokeType (1.0f), transform);
+
+            g.setColour (juce::Colour (ClaymoreColors::ledActive));
+            g.strokePath (paths.post, juce::PathStrokeType (1.0f), transform);
+        }
+
+        // Subtle rim
+        g.setColour (juce::Colour (0x18000000));
+        g.drawRoundedRectangle (bounds, 3.0f, 0.5f);
+    }
+
+    void mouseDown (const juce::MouseEvent&) override
+    {
+        showScope = ! showScope;
+        repaint();
+    }
+
+private:
+    static constexpr int   numPathPoints = 256;
+    static constexpr int   scopeLength   = 512;
+    static constexpr float minFrequency  = 20.0f;
+
+    /** One analysis frame: heights (0 = top, 1 = bottom) at evenly spaced x. */
+    struct Frame
+    {
+        std::array<float, numPathPoints> pre {}, post {};
+        std::array<float, scopeLength>   scope {};
+        double sampleRate = 0.0;
+    };
+
+    /** Normalised (0..1) paths of the frame being painted (message thread only). */
+    struct Paths
+    {
+        juce::Path pre, post, scope;
+        juce::Path spectrumGrid, scopeGrid;
+        double     gridSampleRate = 0.0;   // grids are rebuilt only when this changes
+    };
+
+    //==========================================================================
+    class AnalysisThread : public juce::Thread
+    {
+    public:
+        explicit AnalysisThread (AnalyzerFeed& feedToUse)
+            : juce::Thread ("Claymore Analyzer"), feed (feedToUse)
+        {
+            for (auto& stream : streams)
+            {
+                stream.history.assign (static_cast<size_t> (fftSize), 0.0f);
+                stream.smoothedDB.assign (static_cast<size_t> (numBins), floorDB);
+            }
+
+            fftData.assign (static_cast<size_t> (2 * fftSize), 0.0f);
+            pullScratch.assign (static_cast<size_t> (fftSize), 0.0f);
+        }
+
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                analyseFrame();
+                wait (frameIntervalMs);
+            }
+        }
+
+        /**
+         * Message thread: swaps the newest published frame in for the one it was reading.
+         * Returns false (and keeps the current frame) if nothing was published since.
+         */
+        bool acquireLatest()
+        {
+            if ((latestIndex.load (std::memory_order_relaxed) & freshFlag) == 0)
+                return false;
+
+            readIndex = latestIndex.exchange (readIndex, std::memory_order_acq_rel) & indexMask;
+            return true;
+        }
+
+        /** Message thread: the frame the last acquireLatest() returned. */
+        const Frame& getAcquired() const { return frames[static_cast<size_t> (readIndex)]; }
+
+        bool hasNewerResult() const
+        {
+            return (latestIndex.load (std::memory_order_relaxed) & freshFlag) != 0;
+        }
+
+    private:
+        static constexpr int   fftOrder        = 11;                  // 2048-point FFT
+        static constexpr int   fftSize         = 1 << fftOrder;
+        static constexpr int   numBins         = fftSize / 2 + 1;
+        static constexpr int   frameIntervalMs = 33;
+        static constexpr float floorDB         = -90.0f;
+        static constexpr float releaseCoeff    = 0.8f;                // per frame, falling bins only
+
+        struct StreamState
+        {
+            std::vector<float> history;      // newest fftSize samples, oldest first
+            std::vector<float> smoothedDB;   // per bin
+        };
+
+        void analyseFrame()
+        {
+            const double sampleRate = feed.getSampleRate();
+            auto& back = frames[static_cast<size_t> (writeIndex)];
+
+            const bool preChanged  = analyseStream (streams[0], AnalyzerFeed::Stream::pre,  sampleRate, back.pre);
+            const bool postChanged = analyseStream (streams[1], AnalyzerFeed::Stream::post, sampleRate, back.post);
+
+            // Silence has settled at the floor: keep the current frame, no repaint
+            if (! preChanged && ! postChanged)
+                return;
+
+            buildScope (streams[1].history, back.scope);
+            back.sampleRate = sampleRate;
+
+            // Publish: the written frame becomes the latest, the previous latest is reused
+            writeIndex = latestIndex.exchange (writeIndex | freshFlag, std::memory_order_acq_rel) & indexMask;
+        }
+
+        /** Returns false once a silent stream has fully decayed (nothing new to draw). The
+            points are always rewritten, so a frame never holds a stale stream. */
+        bool analyseStream (StreamState& stream, AnalyzerFeed::Stream id, double sampleRate,
+                            std::array<float, numPathPoints>& points)
+        {
+            // Drain everything pending, keeping the newest fftSize samples
+            bool receivedSamples = false;
+            for (int got; (got = feed.pull (id, pullScratch.data(), fftSize)) > 0;)
+            {
+                auto& history = stream.history;
+                std::move (history.begin() + got, history.end(), history.begin());
+                std::copy_n (pullScratch.data(), got, history.end() - got);
+                receivedSamples = true;
+            }
+
+            // Window + magnitude spectrum (no new audio = silence, bins fall away)
+            if (receivedSamples)
+            {
+                std::copy (stream.history.begin(), stream.history.end(), fftData.begin());
+                std::fill (fftData.begin() + fftSize, fftData.end(), 0.0f);
+                window.multiplyWithWindowingTable (fftData.data(), static_cast<size_t> (fftSize));
+                fft.performFrequencyOnlyForwardTransform (fftData.data(), true);
+            }
+
+            // Hann coherent gain is 0.5: a full-scale sine reads 0 dBFS
+            const float norm = 4.0f / static_cast<float> (fftSize);
+            float loudestBinDB = floorDB;
+            for (int bin = 0; bin < numBins; ++bin)
+            {
+                const float dB = receivedSamples
+                                     ? juce::Decibels::gainToDecibels (fftData[static_cast<size_t> (bin)] * norm, floorDB)
+                                     : floorDB;
+
+                auto& smoothed = stream.smoothedDB[static_cast<size_t> (bin)];
+                smoothed = dB > smoothed ? dB : releaseCoeff * smoothed + (1.0f - releaseCoeff) * dB;
+                loudestBinDB = juce::jmax (loudestBinDB, smoothed);
+            }
+
+            // Log-frequency path: each point takes the loudest bin it covers
+            const float nyquist  = static_cast<float> (sampleRate * 0.5);
+            const float binWidth = static_cast<float> (sampleRate) / static_cast<float> (fftSize);
+            const float maxFrequency = juce::jmin (20000.0f, nyquist);
+
+            for (int i = 0; i < numPathPoints; ++i)
+            {
+                const float x  = static_cast<float> (i) / static_cast<float> (numPathPoints - 1);
+                const float f0 = frequencyAt (x, maxFrequency);
+                const float f1 = frequencyAt (static_cast<float> (i + 1) / static_cast<float> (numPathPoints - 1), maxFrequency);
+
+                const int firstBin = juce::jlimit (0, numBins - 1, static_cast<int> (f0 / binWidth));
+                const int lastBin  = juce::jlimit (firstBin, numBins - 1, static_cast<int> (f1 / binWidth));
+
+                float dB = floorDB;
+                for (int bin = firstBin; bin <= lastBin; ++bin)
+                    dB = juce::jmax (dB, stream.smoothedDB[static_cast<size_t> (bin)]);
+
+                points[static_cast<size_t> (i)] = juce::jmap (juce::jmin (dB, 0.0f), floorDB, 0.0f, 1.0f, 0.0f);
+            }
+
+            return receivedSamples || loudestBinDB >= floorDB + 0.1f;
+        }
+
+        /** First rising zero crossing before the newest scopeLength samples, then scopeLength samples. */
+        static void buildScope (const std::vector<float>& history, std::array<float, scopeLength>& points)
+        {
+            int start = fftSize - scopeLength;
+            for (int i = fftSize - 2 * scopeLength; i < fftSize - scopeLength; ++i)
+            {
+                if (history[static_cast<size_t> (i)] <= 0.0f && history[static_cast<size_t> (i + 1)] > 0.0f)
+                {
+                    start = i;
+                    break;
+                }
+            }
+
+            for (int i = 0; i < scopeLength; ++i)
+                points[static_cast<size_t> (i)] = 0.5f - 0.5f * juce::jlimit (-1.0f, 1.0f, history[static_cast<size_t> (start + i)]);
+        }
+
+        static float frequencyAt (float proportion, float maxFrequency)
+        {
+            return minFrequency * std::pow (maxFrequency / minFrequency, proportion);
+        }
+
+        AnalyzerFeed& feed;
+
+        juce::dsp::FFT fft { fftOrder };
+        juce::dsp::WindowingFunction<float> window { static_cast<size_t> (fftSize),
+                                                     juce::dsp::WindowingFunction<float>::hann, false };
+
+        StreamState        streams[2];   // pre, post
+        std::vector<float> fftData;
+        std::vector<float> pullScratch;
+
+        // Triple buffer: this thread fills frames[writeIndex], the message thread reads
+        // frames[readIndex], latestIndex holds the third (+ freshFlag once published).
+        // Each side only ever swaps its own index with latestIndex.
+        static constexpr int indexMask = 3;
+        static constexpr int freshFlag = 4;
+
+        std::array<Frame, 3> frames {};
+        int                  writeIndex = 0;   // analysis thread only
+        int                  readIndex  = 1;   // message thread only
+        std::atomic<int>     latestIndex { 2 };
+    };
+
+    //==========================================================================
+    /** Message thread: paths from a frame's points (the grids only when the rate changes). */
+    void buildPaths (const Frame& frame)
+    {
+        auto buildLine = [] (juce::Path& path, const float* heights, int numPoints)
+        {
+            path.clear();
+            path.preallocateSpace (3 * numPoints);
+
+            for (int i = 0; i < numPoints; ++i)
+            {
+                const float x = static_cast<float> (i) / static_cast<float> (numPoints - 1);
+                if (i == 0)
+                    path.startNewSubPath (x, heights[i]);
+                else
+                    path.lineTo (x, heights[i]);
+            }
+        };
+
+        buildLine (paths.pre,   frame.pre.data(),   numPathPoints);
+        buildLine (paths.post,  frame.post.data(),  numPathPoints);
+        buildLine (paths.scope, frame.scope.data(), scopeLength);
+
+        if (paths.gridSampleRate != frame.sampleRate)
+            buildGrids (frame.sampleRate);
+    }
+
+    /** Decade lines (100 Hz, 1 kHz, 10 kHz) and a scope centre line. */
+    void buildGrids (double sampleRate)
+    {
+        paths.gridSampleRate = sampleRate;
+        const float maxFrequency = juce::jmin (20000.0f, static_cast<float> (sampleRate * 0.5));
+
+        paths.spectrumGrid.clear();
+        for (float f : { 100.0f, 1000.0f, 10000.0f })
+        {
+            if (f >= maxFrequency)
+                continue;
+
+            const float x = std::log (f / minFrequency) / std::log (maxFrequency / minFrequency);
+            paths.spectrumGrid.startNewSubPath (x, 0.0f);
+            paths.spectrumGrid.lineTo (x, 1.0f);
+        }
+
+        paths.scopeGrid.clear();
+        paths.scopeGrid.startNewSubPath (0.0f, 0.5f);
+        paths.scopeGrid.lineTo (1.0f, 0.5f);
+    }
+
+    //==========================================================================
+    AnalyzerFeed&  feed;
+    AnalysisThread analysis;
+
+    Paths paths;
+    bool  showScope = false;
+
+    // Repaint only when the analysis thread has published a new frame
+    juce::VBlankAttachment vblank { this, [this]
+    {
+        if (analysis.hasNewerResult())
+            repaint();
+    } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyzer)
+};
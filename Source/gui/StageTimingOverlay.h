@@ -0,0 +1,107 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "../dsp/StageTimers.h"
+#include "../look/ClaymoreTheme.h"
+
+/**
+ * StageTimingOverlay — hidden debug panel: mean and p99 µs per processBlock() stage and
+ * each stage's share of the callback budget (block length), from StageTimers.
+ *
+ * Shift + Alt click on the editor panel toggles it (CLAYMORE_STAGE_TIMERS builds only).
+ * While visible it switches the processor's stage timers on; the editor's vblank callback
+ * calls update(), which drains frames into a histogram and refreshes the table twice a
+ * second over the callbacks of that window.
+ */
+class StageTimingOverlay : public juce::Component
+{
+public:
+    explicit StageTimingOverlay (StageTimers& timersToShow)
+        : timers (timersToShow)
+    {
+        setInterceptsMouseClicks (false, false);
+    }
+
+    ~StageTimingOverlay() override
+    {
+        timers.setActive (false);
+    }
+
+    /** Vblank-rate feed; cheap no-op while hidden. */
+    void update()
+    {
+        if (! isVisible())
+            return;
+
+        timers.drainInto (window);
+
+        const double nowMs = juce::Time::getMillisecondCounterHiRes();
+        if (nowMs - windowStartMs < windowMs)
+            return;
+
+        windowStartMs = nowMs;
+        shown = window;
+        window.clear();
+        repaint();
+    }
+
+    void visibilityChanged() override
+    {
+        timers.setActive (isVisible());
+        window.clear();
+        shown.clear();
+        windowStartMs = juce::Time::getMillisecondCounterHiRes();
+    }
+
+    void paint (juce::Graphics& g) override
+    {
+        const auto bounds = getLocalBounds().toFloat();
+
+        g.setColour (juce::Colour (ClaymoreColors::knobBody).withAlpha (0.92f));
+        g.fillRoundedRectangle (bounds, 4.0f);
+
+        g.setFont (juce::FontOptions (juce::Font::getDefaultMonospacedFontName(), 10.0f, juce::Font::plain));
+
+        auto area = getLocalBounds().reduced (8, 6);
+        auto drawRow = [&] (const juce::String& text, juce::Colour colour)
+        {
+            g.setColour (colour);
+            g.drawText (text, area.removeFromTop (rowHeight), juce::Justification::centredLeft, false);
+        };
+
+        const auto header = juce::Colour (ClaymoreColors::ledActive);
+        const auto text   = juce::Colour (ClaymoreColors::indicator);
+
+        drawRow (juce::String::formatted ("%-10s %8s %8s %7s", "stage", "mean us", "p99 us", "budget"), header);
+
+        if (shown.getNumCallbacks() == 0)
+        {
+            drawRow ("waiting for audio...", text);
+            return;
+        }
+
+        for (int row = 0; row < StageTimers::Histogram::numRows; ++row)
+        {
+            drawRow (juce::String::formatted ("%-10s %8.2f %8.2f %6.1f%%",
+                                              StageTimers::Histogram::getRowName (row),
+                                              shown.getMean (row), shown.getPercentile (row, 0.99),
+                                              shown.getBudgetPercent (row)),
+                     row == StageTimers::Histogram::total ? header : text);
+        }
+
+        drawRow (juce::String (shown.getNumCallbacks()) + " callbacks / " + juce::String (windowMs / 1000.0, 1) + " s",
+                 text.withAlpha (0.6f));
+    }
+
+    /** Height that fits the header, every row and the footer. */
+    static constexpr int getPreferredHeight() { return (StageTimers::Histogram::numRows + 2) * rowHeight + 12; }
+
+private:
+    static constexpr int    rowHeight = 13;
+    static constexpr double windowMs  = 500.0;
+
+    StageTimers& timers;
+    StageTimers::Histogram window;   // filling
+    StageTimers::Histogram shown;    // last complete window (painted)
+    double windowStartMs = 0.0;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+/**
+ * StaticLayerRenderer — rasterises a component's static background once per raster scale
+ * (UI scale x display scale) on a worker thread.
+ *
+ * The paint function draws in the component's design coordinates; the raster is that
+ * design size times the scale, so it maps 1:1 onto physical pixels. The first raster is
+ * rendered synchronously (nothing to show yet). After that a scale change — a resize drag
+ * or a move to another display — only queues a render: paint keeps blitting the previous
+ * raster, stretched, and the owner is repainted when the new one lands. Intermediate
+ * scales requested while a render runs are coalesced into the latest one.
+ *
+ * The paint function runs on the worker thread: it must only read state that stays
+ * constant while the renderer exists (design-space geometry, shared theme assets) or
+ * that is published atomically, like the theme's fonts — call invalidate() when it changes.
+ */
+class StaticLayerRenderer : private juce::Thread
+{
+public:
+    using PaintFn = std::function<void (juce::Graphics&)>;
+
+    StaticLayerRenderer (juce::Component& ownerToRepaint, int designWidthToUse, int designHeightToUse,
+                         PaintFn paintFnToUse)
+        : juce::Thread ("Claymore Static Layer"),
+          owner (&ownerToRepaint),
+          designWidth (designWidthToUse),
+          designHeight (designHeightToUse),
+          paintFn (std::move (paintFnToUse))
+    {
+    }
+
+    ~StaticLayerRenderer() override
+    {
+        stop();
+    }
+
+    /** Stops the worker. Call before anything the paint function reads is destroyed. */
+    void stop()
+    {
+        stopThread (2000);
+    }
+
+    /** Message thread: the raster to draw for rasterScale — possibly one at a previous
+        scale while the new one renders. */
+    juce::Image getLayer (float rasterScale)
+    {
+        {
+            const juce::ScopedLock lock (layerLock);
+            if (layer.isValid())
+            {
+                if (layerScale != rasterScale)
+                    request (rasterScale);
+
+                return layer;
+            }
+        }
+
+        // First paint: render in place so the editor never opens blank
+        auto image = render (rasterScale);
+
+        const juce::ScopedLock lock (layerLock);
+        layer      = image;
+        layerScale = rasterScale;
+        return image;
+    }
+
+    /** Message thread: what the paint function draws has changed (e.g. the fonts loaded).
+        Re-renders at the latest scale; paint keeps blitting the stale raster until then. */
+    void invalidate()
+    {
+        auto scale = lastRequestedScale;
+        if (scale <= 0.0f)
+        {
+            const juce::ScopedLock lock (layerLock);
+            scale = layerScale;
+        }
+
+        if (scale <= 0.0f)
+            return;   // nothing rendered yet: the first paint will use the new content
+
+        lastRequestedScale = 0.0f;
+        request (scale);
+    }
+
+private:
+    void request (float rasterScale)
+    {
+        if (rasterScale == lastRequestedScale)
+            return;
+
+        lastRequestedScale = rasterScale;
+        requestedScale.store (rasterScale, std::memory_order_relaxed);
+
+        if (! isThreadRunning())
+            startThread (juce::Thread::Priority::low);
+
+        notify();
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            const auto scale = requestedScale.exchange (0.0f, std::memory_order_relaxed);
+            if (scale <= 0.0f)
+            {
+                wait (-1);
+                continue;
+            }
+
+            auto image = render (scale);
+            if (threadShouldExit())
+                break;
+
+            {
+                const juce::ScopedLock lock (layerLock);
+                layer      = image;
+                layerScale = scale;
+            }
+
+            juce::MessageManager::callAsync ([safeOwner = owner]
+            {
+                if (auto* c = safeOwner.getComponent())
+                    c->repaint();
+            });
+        }
+    }
+
+    /** Software image: also runs on the worker thread, where no native (GPU-backed) image may be created. */
+    juce::Image render (float rasterScale) const
+    {
+        juce::Image image (juce::Image::RGB,
+                           juce::jmax (1, juce::roundToInt ((float) designWidth  * rasterScale)),
+                           juce::jmax (1, juce::roundToInt ((float) designHeight * rasterScale)),
+                           false, juce::SoftwareImageType());
+
+        juce::Graphics g (image);
+        g.addTransform (juce::AffineTransform::scale (rasterScale));
+        paintFn (g);
+        return image;
+    }
+
+    // Created on the message thread; the worker only copies it into the repaint callback
+    const juce::Component::SafePointer<juce::Component> owner;
+    const int     designWidth;
+    const int     designHeight;
+    const PaintFn paintFn;
+
+    juce::CriticalSection layerLock;
+    juce::Image           layer;
+    float                 layerScale = 0.0f;
+
+    std::atomic<float> requestedScale { 0.0f };
+    float              lastRequestedScale = 0.0f;   // message thread only
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StaticLayerRenderer)
+};
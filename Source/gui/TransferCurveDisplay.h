@@ -0,0 +1,206 @@
+#pragma once
+
+#include <atomic>
+#include <unordered_map>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "../Parameters.h"
+#include "../dsp/fuzz/FuzzCore.h"
+#include "../look/ClaymoreTheme.h"
+
+/**
+ * TransferCurveDisplay — static input → output curve of the current circuit, drive and sag,
+ * computed by FuzzCore::processTransferCurve() (the shaper's own clip and sag code).
+ *
+ * Curves are cached per key (ClipType, drive and sag quantised to 1/50). The vblank
+ * callback reads the three raw parameter values; when the key is unchanged it returns
+ * straight away. A cached key just swaps the path in and repaints. A new key is handed
+ * to a worker thread, which evaluates the whole curve in one batched call, builds the
+ * path and caches it; the next vblank picks it up. Nothing here touches the audio
+ * thread's FuzzCoreState.
+ */
+class TransferCurveDisplay : public juce::Component
+{
+public:
+    explicit TransferCurveDisplay (juce::AudioProcessorValueTreeState& apvts)
+        : driveParam    (apvts.getRawParameterValue (ParamIDs::drive)),
+          clipTypeParam (apvts.getRawParameterValue (ParamIDs::clipType)),
+          sagParam      (apvts.getRawParameterValue (ParamIDs::sag))
+    {
+        setInterceptsMouseClicks (false, false);
+        worker.startThread (juce::Thread::Priority::low);
+    }
+
+    ~TransferCurveDisplay() override
+    {
+        worker.stopThread (1000);
+    }
+
+    void paint (juce::Graphics& g) override
+    {
+        const auto bounds = getLocalBounds().toFloat();
+
+        // Dark screen, matching the analyzer
+        g.setColour (juce::Colour (ClaymoreColors::knobBody));
+        g.fillRoundedRectangle (bounds, 3.0f);
+
+        const auto screen    = bounds.reduced (3.0f);
+        const auto transform = juce::AffineTransform::scale (screen.getWidth(), screen.getHeight())
+                                                     .translated (screen.getX(), screen.getY());
+
+        // Axes through the origin
+        g.setColour (juce::Colour (ClaymoreColors::indicator).withAlpha (0.12f));
+        g.drawHorizontalLine (juce::roundToInt (screen.getCentreY()), screen.getX(), screen.getRight());
+        g.drawVerticalLine   (juce::roundToInt (screen.getCentreX()), screen.getY(), screen.getBottom());
+
+        g.setColour (juce::Colour (ClaymoreColors::ledActive));
+        g.strokePath (curve, juce::PathStrokeType (1.2f), transform);
+
+        // Subtle rim
+        g.setColour (juce::Colour (0x18000000));
+        g.drawRoundedRectangle (bounds, 3.0f, 0.5f);
+    }
+
+private:
+    static constexpr int numPoints     = 128;
+    static constexpr int quantiseSteps = 50;
+    static constexpr int maxCachedKeys = 512;
+    static constexpr juce::uint32 noKey = 0xffffffff;
+
+    // Output range drawn: ±1.5 covers the sag makeup (up to 1.5x)
+    static constexpr float outputRange = 1.5f;
+
+    static juce::uint32 makeKey (int clipType, int driveStep, int sagStep)
+    {
+        return (static_cast<juce::uint32> (clipType) << 16)
+             | (static_cast<juce::uint32> (driveStep) << 8)
+             |  static_cast<juce::uint32> (sagStep);
+    }
+
+    //==========================================================================
+    /** Evaluates requested keys off the message thread and fills the shared cache. */
+    class CurveWorker : public juce::Thread
+    {
+    public:
+        CurveWorker() : juce::Thread ("Claymore Transfer Curve")
+        {
+            for (int i = 0; i < numPoints; ++i)
+                inputRamp[i] = -1.0f + 2.0f * static_cast<float> (i) / static_cast<float> (numPoints - 1);
+        }
+
+        void request (juce::uint32 key)
+        {
+            requestedKey.store (key, std::memory_order_relaxed);
+            notify();
+        }
+
+        /** Message thread: copies a cached curve into dest. Returns false on a miss. */
+        bool lookUp (juce::uint32 key, juce::Path& dest)
+        {
+            const juce::ScopedLock lock (cacheLock);
+            const auto it = cache.find (key);
+            if (it == cache.end())
+                return false;
+
+            dest = it->second;
+            return true;
+        }
+
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                const auto key = requestedKey.exchange (noKey, std::memory_order_relaxed);
+                if (key == noKey)
+                {
+                    wait (-1);
+                    continue;
+                }
+
+                {
+                    const juce::ScopedLock lock (cacheLock);
+                    if (cache.count (key) > 0)
+                        continue;
+                }
+
+                auto path = computeCurve (key);
+
+                const juce::ScopedLock lock (cacheLock);
+                if (static_cast<int> (cache.size()) >= maxCachedKeys)
+                    cache.clear();
+                cache.emplace (key, std::move (path));
+            }
+        }
+
+    private:
+        juce::Path computeCurve (juce::uint32 key)
+        {
+            const int   clipType = static_cast<int> (key >> 16);
+            const float drive    = static_cast<float> ((key >> 8) & 0xff) / static_cast<float> (quantiseSteps);
+            const float sag      = static_cast<float> (key & 0xff) / static_cast<float> (quantiseSteps);
+
+            // One batched call through the shaper's own clip + sag code
+            FuzzCore::processTransferCurve (inputRamp, outputs, numPoints,
+                                            FuzzConfig::mapDrive (drive), clipType, sag);
+
+            juce::Path path;
+            path.preallocateSpace (numPoints * 3);
+            for (int i = 0; i < numPoints; ++i)
+            {
+                const float x = static_cast<float> (i) / static_cast<float> (numPoints - 1);
+                const float y = 0.5f - 0.5f * juce::jlimit (-1.0f, 1.0f, outputs[i] / outputRange);
+                if (i == 0)
+                    path.startNewSubPath (x, y);
+                else
+                    path.lineTo (x, y);
+            }
+            return path;
+        }
+
+        float inputRamp[numPoints] {};
+        float outputs[numPoints] {};
+
+        std::atomic<juce::uint32> requestedKey { noKey };
+
+        juce::CriticalSection                        cacheLock;
+        std::unordered_map<juce::uint32, juce::Path> cache;
+    };
+
+    //==========================================================================
+    void refresh()
+    {
+        auto quantise = [] (const std::atomic<float>* p)
+        {
+            return juce::jlimit (0, quantiseSteps, juce::roundToInt (p->load (std::memory_order_relaxed) * quantiseSteps));
+        };
+
+        const auto key = makeKey (static_cast<int> (clipTypeParam->load (std::memory_order_relaxed)),
+                                  quantise (driveParam), quantise (sagParam));
+        if (key == shownKey)
+            return;
+
+        if (worker.lookUp (key, curve))
+        {
+            shownKey = key;
+            repaint();
+        }
+        else if (key != pendingKey)
+        {
+            pendingKey = key;
+            worker.request (key);
+        }
+    }
+
+    std::atomic<float>* driveParam    = nullptr;
+    std::atomic<float>* clipTypeParam = nullptr;
+    std::atomic<float>* sagParam      = nullptr;
+
+    CurveWorker  worker;
+    juce::Path   curve;
+    juce::uint32 shownKey   = noKey;
+    juce::uint32 pendingKey = noKey;
+
+    juce::VBlankAttachment vblank { this, [this] { refresh(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TransferCurveDisplay)
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+/**
+ * ClaymoreFonts — the embedded typefaces, parsed once per process, lazily.
+ *
+ * Owned by the theme's shared resources, so nothing is loaded until the first editor
+ * exists (plugin scans and headless hosts never parse the fonts). Construction only posts
+ * the load; the typefaces are created on the message thread right after, so the editor's
+ * constructor never waits on them. Until then the getters return nullptr and the theme
+ * falls back to the default typefaces; the editor restyles itself once isReady() is true.
+ *
+ * The typefaces are written before the release store of ready and never change after, so
+ * any thread (the static layer worker included) may read them once isReady() is true.
+ */
+class ClaymoreFonts : private juce::AsyncUpdater
+{
+public:
+    ClaymoreFonts();
+    ~ClaymoreFonts() override;
+
+    bool isReady() const noexcept { return ready.load (std::memory_order_acquire); }
+
+    juce::Typeface::Ptr getCormorant()   const noexcept { return isReady() ? cormorant   : nullptr; }
+    juce::Typeface::Ptr getDMSans()      const noexcept { return isReady() ? dmSans      : nullptr; }
+    juce::Typeface::Ptr getDMSansLight() const noexcept { return isReady() ? dmSansLight : nullptr; }
+
+private:
+    void handleAsyncUpdate() override;
+
+    juce::Typeface::Ptr cormorant;
+    juce::Typeface::Ptr dmSans;
+    juce::Typeface::Ptr dmSansLight;
+
+    std::atomic<bool> ready { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ClaymoreFonts)
+};
@@ -3,19 +3,6 @@
 
 ClaymoreTheme::ClaymoreTheme()
 {
-    // Load embedded fonts from BinaryData
-    cormorantTypeface = juce::Typeface::createSystemTypefaceFor (
-        ClaymoreAssets::CormorantGaramond_ttf,
-        ClaymoreAssets::CormorantGaramond_ttfSize);
-
-    dmSansTypeface = juce::Typeface::createSystemTypefaceFor (
-        ClaymoreAssets::DMSansRegular_ttf,
-        ClaymoreAssets::DMSansRegular_ttfSize);
-
-    dmSansLightTypeface = juce::Typeface::createSystemTypefaceFor (
-        ClaymoreAssets::DMSansLight_ttf,
-        ClaymoreAssets::DMSansLight_ttfSize);
-
     // Slider colour tokens
     setColour (juce::Slider::rotarySliderFillColourId,    juce::Colour (ClaymoreColors::accent));
     setColour (juce::Slider::rotarySliderOutlineColourId, juce::Colour (ClaymoreColors::border));
@@ -26,137 +13,172 @@ ClaymoreTheme::ClaymoreTheme()
     setColour (juce::PopupMenu::textColourId,                  juce::Colour (ClaymoreColors::labelText));
     setColour (juce::PopupMenu::highlightedBackgroundColourId, juce::Colour (ClaymoreColors::accent).withAlpha (0.15f));
     setColour (juce::PopupMenu::highlightedTextColourId,       juce::Colour (ClaymoreColors::primaryText));
-
-    // Generate grain texture once (128x128 tile, dark speckling for light surface)
-    grainTexture = generateGrainTexture (128, 128, 1.0f);
 }
 
+ClaymoreTheme::~ClaymoreTheme() = default;
+
 //==============================================================================
 // drawRotarySlider — dark anthracite knob with LED dot arc
-
-void ClaymoreTheme::drawRotarySlider (juce::Graphics& g,
-                                       int x, int y, int width, int height,
-                                       float sliderPos,
-                                       float rotaryStartAngle,
-                                       float rotaryEndAngle,
-                                       juce::Slider& /*slider*/)
+//
+// The fast path is a filmstrip: numKnobFrames complete knob images per (size, angles,
+// display scale), rendered on a background thread; a repaint is then a single blit.
+//
+// Until a knob's filmstrip is ready it is drawn from two cached static layers, with only
+// the lit LEDs, the knurl and the pointer drawn as vectors:
+//   base layer  (cached)  — LED arc (all dots unlit), chassis cutout, drop shadow, skirt
+//   active LEDs (frame)   — lit dots drawn over their unlit versions
+//   knurl       (frame)   — rotates with the knob
+//   cap layer   (cached)  — cap shadow on skirt, cap, lip, vignette, outer rim
+//   pointer     (frame)   — indicator groove
+
+namespace
 {
-    auto componentRadius = (float) juce::jmin (width / 2, height / 2);
-    auto centreX = (float) x + (float) width  * 0.5f;
-    auto centreY = (float) y + (float) height * 0.5f;
-
-    // Sizing — LEDs on chassis surface, knob (cap+skirt) through cutout hole
-    auto dotRadius     = juce::jmax (2.5f, componentRadius * 0.055f);
-    auto dotArcRadius  = componentRadius - dotRadius - 1.0f;
-    auto surfaceMargin = juce::jmax (5.0f, componentRadius * 0.14f);
-    auto cutoutRadius  = dotArcRadius - surfaceMargin;
-    auto cutoutGap     = juce::jmax (2.0f, componentRadius * 0.04f);
-    auto radius        = cutoutRadius - cutoutGap;
-    auto skirtWidth    = juce::jmax (2.5f, radius * 0.09f);
-    auto capRadius     = radius - skirtWidth;
-    auto angle         = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
-
-    // 1. Glass-dome LED arc — surface-mounted on chassis
-    {
-        const int numDots = 11;
-        for (int i = 0; i < numDots; ++i)
+    /** Knob dimensions derived from the component size (shared by cached and live layers). */
+    struct KnobGeometry
+    {
+        KnobGeometry (float x, float y, int width, int height)
         {
-            float dotNorm  = (float) i / (float) (numDots - 1);
-            float dotAngle = rotaryStartAngle + dotNorm * (rotaryEndAngle - rotaryStartAngle);
-            float dotX     = centreX + dotArcRadius * std::sin (dotAngle);
-            float dotY     = centreY - dotArcRadius * std::cos (dotAngle);
-            bool isActive  = dotNorm <= sliderPos + 0.001f;
-
-            g.setColour (isActive ? juce::Colour (ClaymoreColors::ledActive)
-                                  : juce::Colour (ClaymoreColors::ledInactive));
-            g.fillEllipse (dotX - dotRadius, dotY - dotRadius,
-                           dotRadius * 2.0f, dotRadius * 2.0f);
-
-            // Glass dome highlight
-            juce::ColourGradient dome (
-                juce::Colour (0xffffffff).withAlpha (isActive ? 0.20f : 0.10f),
-                dotX, dotY - dotRadius * 0.5f,
-                juce::Colours::transparentBlack,
-                dotX, dotY + dotRadius * 0.6f, false);
-            g.setGradientFill (dome);
-            g.fillEllipse (dotX - dotRadius, dotY - dotRadius,
-                           dotRadius * 2.0f, dotRadius * 2.0f);
-
-            if (isActive)
-            {
-                float specR = dotRadius * 0.28f;
-                g.setColour (juce::Colour (0x50ffffff));
-                g.fillEllipse (dotX - dotRadius * 0.22f - specR,
-                               dotY - dotRadius * 0.28f - specR,
-                               specR * 2.0f, specR * 2.0f);
-            }
+            const auto componentRadius = (float) juce::jmin (width / 2, height / 2);
+            centreX = x + (float) width  * 0.5f;
+            centreY = y + (float) height * 0.5f;
+
+            // Sizing — LEDs on chassis surface, knob (cap+skirt) through cutout hole
+            dotRadius    = juce::jmax (2.5f, componentRadius * 0.055f);
+            dotArcRadius = componentRadius - dotRadius - 1.0f;
+            const auto surfaceMargin = juce::jmax (5.0f, componentRadius * 0.14f);
+            cutoutRadius = dotArcRadius - surfaceMargin;
+            const auto cutoutGap = juce::jmax (2.0f, componentRadius * 0.04f);
+            radius       = cutoutRadius - cutoutGap;
+            skirtWidth   = juce::jmax (2.5f, radius * 0.09f);
+            capRadius    = radius - skirtWidth;
         }
-    }
 
-    // 2. Chassis cutout — warm dark recess, not black void (#5)
-    {
-        g.setColour (juce::Colour (0xff2a2520));
-        g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
-                       cutoutRadius * 2.0f, cutoutRadius * 2.0f);
-
-        juce::ColourGradient cutShadow (
-            juce::Colour (0x50000000), centreX, centreY - cutoutRadius,
-            juce::Colours::transparentBlack, centreX, centreY - cutoutRadius * 0.3f, false);
-        g.setGradientFill (cutShadow);
-        g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
-                       cutoutRadius * 2.0f, cutoutRadius * 2.0f);
-
-        juce::ColourGradient cutRim (
-            juce::Colours::transparentBlack, centreX, centreY + cutoutRadius * 0.3f,
-            juce::Colour (0x0cffffff), centreX, centreY + cutoutRadius, false);
-        g.setGradientFill (cutRim);
-        g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
-                       cutoutRadius * 2.0f, cutoutRadius * 2.0f);
-    }
+        float centreX, centreY;
+        float dotRadius, dotArcRadius, cutoutRadius, radius, skirtWidth, capRadius;
+    };
+
+    constexpr int numKnobDots   = 11;
+    constexpr int numKnobFrames = 128;   // filmstrip positions across the rotary range
+
+    // Filmstrip cache budget in bytes (ARGB): one 2x hero knob strip alone is about 25 MB
+    constexpr size_t maxFilmstripBytes = size_t (64) << 20;
 
-    // 3. Knob drop shadow — heavy, directional (#2)
+    // 1. Glass-dome LED — surface-mounted on chassis
+    void drawKnobDot (juce::Graphics& g, const KnobGeometry& k, float dotAngle, bool isActive)
     {
-        float shadowOffset = juce::jmax (3.0f, radius * 0.07f);
-        float shadowSpread = juce::jmax (4.0f, radius * 0.10f);
-        for (int pass = 4; pass >= 0; --pass)
+        const float dotRadius = k.dotRadius;
+        const float dotX      = k.centreX + k.dotArcRadius * std::sin (dotAngle);
+        const float dotY      = k.centreY - k.dotArcRadius * std::cos (dotAngle);
+
+        g.setColour (isActive ? juce::Colour (ClaymoreColors::ledActive)
+                              : juce::Colour (ClaymoreColors::ledInactive));
+        g.fillEllipse (dotX - dotRadius, dotY - dotRadius,
+                       dotRadius * 2.0f, dotRadius * 2.0f);
+
+        // Glass dome highlight
+        juce::ColourGradient dome (
+            juce::Colour (0xffffffff).withAlpha (isActive ? 0.20f : 0.10f),
+            dotX, dotY - dotRadius * 0.5f,
+            juce::Colours::transparentBlack,
+            dotX, dotY + dotRadius * 0.6f, false);
+        g.setGradientFill (dome);
+        g.fillEllipse (dotX - dotRadius, dotY - dotRadius,
+                       dotRadius * 2.0f, dotRadius * 2.0f);
+
+        if (isActive)
         {
-            float spread = shadowSpread * ((float) pass / 4.0f);
-            float alpha  = 0.06f + 0.19f * (1.0f - (float) pass / 4.0f);
-            g.setColour (juce::Colours::black.withAlpha (alpha));
-            g.fillEllipse (centreX - radius - spread,
-                           centreY - radius - spread + shadowOffset,
-                           (radius + spread) * 2.0f, (radius + spread) * 2.0f);
+            float specR = dotRadius * 0.28f;
+            g.setColour (juce::Colour (0x50ffffff));
+            g.fillEllipse (dotX - dotRadius * 0.22f - specR,
+                           dotY - dotRadius * 0.28f - specR,
+                           specR * 2.0f, specR * 2.0f);
         }
     }
 
-    // 4. Knob skirt (sidewall) — darker band = visible cylinder edge (#1)
+    float knobDotAngle (int i, float rotaryStartAngle, float rotaryEndAngle)
+    {
+        const float dotNorm = (float) i / (float) (numKnobDots - 1);
+        return rotaryStartAngle + dotNorm * (rotaryEndAngle - rotaryStartAngle);
+    }
+
+    // Base layer: unlit LED arc, cutout, drop shadow, skirt
+    void drawKnobBase (juce::Graphics& g, const KnobGeometry& k, float rotaryStartAngle, float rotaryEndAngle)
     {
-        juce::ColourGradient skirtGrad (
-            juce::Colour (ClaymoreColors::knobBody).darker (0.15f),
-            centreX, centreY - radius * 0.5f,
-            juce::Colour (ClaymoreColors::knobBody).darker (0.6f),
-            centreX, centreY + radius, false);
-        g.setGradientFill (skirtGrad);
-        g.fillEllipse (centreX - radius, centreY - radius,
-                       radius * 2.0f, radius * 2.0f);
+        const float centreX = k.centreX, centreY = k.centreY;
+        const float cutoutRadius = k.cutoutRadius, radius = k.radius;
+
+        // 1. LED arc, all dots unlit (lit ones are drawn on top per frame)
+        for (int i = 0; i < numKnobDots; ++i)
+            drawKnobDot (g, k, knobDotAngle (i, rotaryStartAngle, rotaryEndAngle), false);
+
+        // 2. Chassis cutout — warm dark recess, not black void (#5)
+        {
+            g.setColour (juce::Colour (0xff2a2520));
+            g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
+                           cutoutRadius * 2.0f, cutoutRadius * 2.0f);
+
+            juce::ColourGradient cutShadow (
+                juce::Colour (0x50000000), centreX, centreY - cutoutRadius,
+                juce::Colours::transparentBlack, centreX, centreY - cutoutRadius * 0.3f, false);
+            g.setGradientFill (cutShadow);
+            g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
+                           cutoutRadius * 2.0f, cutoutRadius * 2.0f);
+
+            juce::ColourGradient cutRim (
+                juce::Colours::transparentBlack, centreX, centreY + cutoutRadius * 0.3f,
+                juce::Colour (0x0cffffff), centreX, centreY + cutoutRadius, false);
+            g.setGradientFill (cutRim);
+            g.fillEllipse (centreX - cutoutRadius, centreY - cutoutRadius,
+                           cutoutRadius * 2.0f, cutoutRadius * 2.0f);
+        }
+
+        // 3. Knob drop shadow — heavy, directional (#2)
+        {
+            float shadowOffset = juce::jmax (3.0f, radius * 0.07f);
+            float shadowSpread = juce::jmax (4.0f, radius * 0.10f);
+            for (int pass = 4; pass >= 0; --pass)
+            {
+                float spread = shadowSpread * ((float) pass / 4.0f);
+                float alpha  = 0.06f + 0.19f * (1.0f - (float) pass / 4.0f);
+                g.setColour (juce::Colours::black.withAlpha (alpha));
+                g.fillEllipse (centreX - radius - spread,
+                               centreY - radius - spread + shadowOffset,
+                               (radius + spread) * 2.0f, (radius + spread) * 2.0f);
+            }
+        }
+
+        // 4. Knob skirt (sidewall) — darker band = visible cylinder edge (#1)
+        {
+            juce::ColourGradient skirtGrad (
+                juce::Colour (ClaymoreColors::knobBody).darker (0.15f),
+                centreX, centreY - radius * 0.5f,
+                juce::Colour (ClaymoreColors::knobBody).darker (0.6f),
+                centreX, centreY + radius, false);
+            g.setGradientFill (skirtGrad);
+            g.fillEllipse (centreX - radius, centreY - radius,
+                           radius * 2.0f, radius * 2.0f);
+        }
     }
 
     // 5. Knurled edge — radial ticks on skirt, rotate with knob (#8, large knobs only)
-    if (radius > 18.0f)
+    void drawKnobKnurl (juce::Graphics& g, const KnobGeometry& k, float angle)
     {
-        int numTicks = juce::jmax (24, (int) (radius * 0.7f));
-        float tickInner = capRadius + skirtWidth * 0.15f;
-        float tickOuter = radius - 0.5f;
+        if (k.radius <= 18.0f)
+            return;
+
+        int numTicks = juce::jmax (24, (int) (k.radius * 0.7f));
+        float tickInner = k.capRadius + k.skirtWidth * 0.15f;
+        float tickOuter = k.radius - 0.5f;
 
         for (int t = 0; t < numTicks; ++t)
         {
             float tickAngle = angle + (float) t / (float) numTicks * juce::MathConstants<float>::twoPi;
             float cosA = std::cos (tickAngle);
             float sinA = std::sin (tickAngle);
-            float x1 = centreX + tickInner * sinA;
-            float y1 = centreY - tickInner * cosA;
-            float x2 = centreX + tickOuter * sinA;
-            float y2 = centreY - tickOuter * cosA;
+            float x1 = k.centreX + tickInner * sinA;
+            float y1 = k.centreY - tickInner * cosA;
+            float x2 = k.centreX + tickOuter * sinA;
+            float y2 = k.centreY - tickOuter * cosA;
 
             float brightness = (t % 2 == 0) ? 0.10f : 0.04f;
             g.setColour (juce::Colours::white.withAlpha (brightness));
@@ -164,89 +186,362 @@ void ClaymoreTheme::drawRotarySlider (juce::Graphics& g,
         }
     }
 
-    // 5b. Cap shadow on skirt — cap raised above skirt casts inward shadow
-    {
-        float shadowInner = capRadius - 1.0f;
-        float shadowOuter = capRadius + skirtWidth * 0.6f;
-        juce::ColourGradient capShadow (
-            juce::Colour (0x30000000), centreX, centreY, // dark at cap edge
-            juce::Colours::transparentBlack, centreX + shadowOuter, centreY, true);
-        capShadow.addColour ((double) shadowInner / (double) shadowOuter, juce::Colour (0x28000000));
-        g.setGradientFill (capShadow);
-        // Clip to skirt ring only (don't darken the cap itself)
-        juce::Path skirtRing;
-        skirtRing.addEllipse (centreX - radius, centreY - radius, radius * 2.0f, radius * 2.0f);
-        skirtRing.addEllipse (centreX - capRadius, centreY - capRadius, capRadius * 2.0f, capRadius * 2.0f);
-        skirtRing.setUsingNonZeroWinding (false);
-        g.saveState();
-        g.reduceClipRegion (skirtRing);
-        g.fillEllipse (centreX - shadowOuter, centreY - shadowOuter,
-                       shadowOuter * 2.0f, shadowOuter * 2.0f);
-        g.restoreState();
-    }
+    // Cap layer: cap shadow on skirt, cap, lip, vignette, outer rim
+    void drawKnobCap (juce::Graphics& g, const KnobGeometry& k)
+    {
+        const float centreX = k.centreX, centreY = k.centreY;
+        const float radius = k.radius, capRadius = k.capRadius, skirtWidth = k.skirtWidth;
 
-    // 6. Knob cap (top face) — radial gradient, light source top-left (#1)
-    {
-        // Highlight offset toward top-left light source
-        float hlX = centreX - capRadius * 0.25f;
-        float hlY = centreY - capRadius * 0.30f;
-
-        juce::ColourGradient capGrad (
-            juce::Colour (ClaymoreColors::knobHighlight).brighter (0.12f),
-            hlX, hlY,
-            juce::Colour (ClaymoreColors::knobBody).darker (0.40f),
-            hlX + capRadius * 1.1f, hlY + capRadius * 1.1f, true);
-        capGrad.addColour (0.25, juce::Colour (ClaymoreColors::knobHighlight));
-        capGrad.addColour (0.55, juce::Colour (ClaymoreColors::knobBody));
-        capGrad.addColour (0.85, juce::Colour (ClaymoreColors::knobBody).darker (0.25f));
-        g.setGradientFill (capGrad);
-        g.fillEllipse (centreX - capRadius, centreY - capRadius,
-                       capRadius * 2.0f, capRadius * 2.0f);
-    }
+        // 5b. Cap shadow on skirt — cap raised above skirt casts inward shadow
+        {
+            float shadowInner = capRadius - 1.0f;
+            float shadowOuter = capRadius + skirtWidth * 0.6f;
+            juce::ColourGradient capShadow (
+                juce::Colour (0x30000000), centreX, centreY, // dark at cap edge
+                juce::Colours::transparentBlack, centreX + shadowOuter, centreY, true);
+            capShadow.addColour ((double) shadowInner / (double) shadowOuter, juce::Colour (0x28000000));
+            g.setGradientFill (capShadow);
+            // Clip to skirt ring only (don't darken the cap itself)
+            juce::Path skirtRing;
+            skirtRing.addEllipse (centreX - radius, centreY - radius, radius * 2.0f, radius * 2.0f);
+            skirtRing.addEllipse (centreX - capRadius, centreY - capRadius, capRadius * 2.0f, capRadius * 2.0f);
+            skirtRing.setUsingNonZeroWinding (false);
+            g.saveState();
+            g.reduceClipRegion (skirtRing);
+            g.fillEllipse (centreX - shadowOuter, centreY - shadowOuter,
+                           shadowOuter * 2.0f, shadowOuter * 2.0f);
+            g.restoreState();
+        }
+
+        // 6. Knob cap (top face) — radial gradient, light source top-left (#1)
+        {
+            // Highlight offset toward top-left light source
+            float hlX = centreX - capRadius * 0.25f;
+            float hlY = centreY - capRadius * 0.30f;
+
+            juce::ColourGradient capGrad (
+                juce::Colour (ClaymoreColors::knobHighlight).brighter (0.12f),
+                hlX, hlY,
+                juce::Colour (ClaymoreColors::knobBody).darker (0.40f),
+                hlX + capRadius * 1.1f, hlY + capRadius * 1.1f, true);
+            capGrad.addColour (0.25, juce::Colour (ClaymoreColors::knobHighlight));
+            capGrad.addColour (0.55, juce::Colour (ClaymoreColors::knobBody));
+            capGrad.addColour (0.85, juce::Colour (ClaymoreColors::knobBody).darker (0.25f));
+            g.setGradientFill (capGrad);
+            g.fillEllipse (centreX - capRadius, centreY - capRadius,
+                           capRadius * 2.0f, capRadius * 2.0f);
+        }
 
-    // 7. Cap-to-skirt lip — bright hairline at cap edge (#1)
-    g.setColour (juce::Colour (0x18ffffff));
-    g.drawEllipse (centreX - capRadius, centreY - capRadius,
-                   capRadius * 2.0f, capRadius * 2.0f, 0.7f);
+        // 7. Cap-to-skirt lip — bright hairline at cap edge (#1)
+        g.setColour (juce::Colour (0x18ffffff));
+        g.drawEllipse (centreX - capRadius, centreY - capRadius,
+                       capRadius * 2.0f, capRadius * 2.0f, 0.7f);
 
-    // 8. Edge vignette on cap
-    {
-        juce::ColourGradient vignette (juce::Colours::transparentBlack, centreX, centreY,
-                                        juce::Colour (0x14000000), centreX, centreY + capRadius, true);
-        vignette.addColour (0.6, juce::Colours::transparentBlack);
-        g.setGradientFill (vignette);
-        g.fillEllipse (centreX - capRadius, centreY - capRadius,
-                       capRadius * 2.0f, capRadius * 2.0f);
-    }
+        // 8. Edge vignette on cap
+        {
+            juce::ColourGradient vignette (juce::Colours::transparentBlack, centreX, centreY,
+                                            juce::Colour (0x14000000), centreX, centreY + capRadius, true);
+            vignette.addColour (0.6, juce::Colours::transparentBlack);
+            g.setGradientFill (vignette);
+            g.fillEllipse (centreX - capRadius, centreY - capRadius,
+                           capRadius * 2.0f, capRadius * 2.0f);
+        }
 
-    // 9. Outer rim
-    g.setColour (juce::Colour (0x28000000));
-    g.drawEllipse (centreX - radius, centreY - radius,
-                   radius * 2.0f, radius * 2.0f, 0.8f);
+        // 9. Outer rim
+        g.setColour (juce::Colour (0x28000000));
+        g.drawEllipse (centreX - radius, centreY - radius,
+                       radius * 2.0f, radius * 2.0f, 0.8f);
+    }
 
     // 10. Indicator groove — shadow/highlight flanking (#7)
+    void drawKnobPointer (juce::Graphics& g, const KnobGeometry& k, float angle)
     {
+        const float capRadius = k.capRadius;
         auto pointerLength = capRadius * 0.6f;
         float lineWidth = juce::jmax (1.5f, capRadius * 0.05f);
+        const auto transform = juce::AffineTransform::rotation (angle).translated (k.centreX, k.centreY);
 
         juce::Path shadowP;
         shadowP.addRectangle (-lineWidth * 0.5f - 0.7f, -capRadius, 0.7f, pointerLength);
-        shadowP.applyTransform (juce::AffineTransform::rotation (angle).translated (centreX, centreY));
+        shadowP.applyTransform (transform);
         g.setColour (juce::Colour (0x28000000));
         g.fillPath (shadowP);
 
         juce::Path highlightP;
         highlightP.addRectangle (lineWidth * 0.5f, -capRadius, 0.7f, pointerLength);
-        highlightP.applyTransform (juce::AffineTransform::rotation (angle).translated (centreX, centreY));
+        highlightP.applyTransform (transform);
         g.setColour (juce::Colour (0x12ffffff));
         g.fillPath (highlightP);
 
         juce::Path p;
         p.addRectangle (-lineWidth * 0.5f, -capRadius, lineWidth, pointerLength);
-        p.applyTransform (juce::AffineTransform::rotation (angle).translated (centreX, centreY));
+        p.applyTransform (transform);
         g.setColour (juce::Colour (ClaymoreColors::indicator));
         g.fillPath (p);
     }
+
+    // Lit LEDs over their unlit versions in the base layer
+    void drawKnobLitDots (juce::Graphics& g, const KnobGeometry& k, float sliderPos,
+                          float rotaryStartAngle, float rotaryEndAngle)
+    {
+        for (int i = 0; i < numKnobDots; ++i)
+            if ((float) i / (float) (numKnobDots - 1) <= sliderPos + 0.001f)
+                drawKnobDot (g, k, knobDotAngle (i, rotaryStartAngle, rotaryEndAngle), true);
+    }
+
+    /** Renders one cached layer at physical resolution (component size x display scale).
+        Software images: the filmstrip renderer calls this off the message thread. */
+    template <typename DrawFn>
+    juce::Image renderKnobLayer (int width, int height, float scale, DrawFn&& draw)
+    {
+        juce::Image image (juce::Image::ARGB,
+                           juce::jmax (1, juce::roundToInt ((float) width  * scale)),
+                           juce::jmax (1, juce::roundToInt ((float) height * scale)),
+                           true, juce::SoftwareImageType());
+        juce::Graphics ig (image);
+        ig.addTransform (juce::AffineTransform::scale (scale));
+        draw (ig, KnobGeometry (0.0f, 0.0f, width, height));
+        return image;
+    }
+
+    juce::Image renderKnobBaseLayer (int width, int height, float scale,
+                                     float rotaryStartAngle, float rotaryEndAngle)
+    {
+        return renderKnobLayer (width, height, scale, [&] (juce::Graphics& ig, const KnobGeometry& k)
+        {
+            drawKnobBase (ig, k, rotaryStartAngle, rotaryEndAngle);
+        });
+    }
+
+    juce::Image renderKnobCapLayer (int width, int height, float scale)
+    {
+        return renderKnobLayer (width, height, scale, [] (juce::Graphics& ig, const KnobGeometry& k)
+        {
+            drawKnobCap (ig, k);
+        });
+    }
+}
+
+//==============================================================================
+/**
+ * Renders knob filmstrips off the message thread. Requests are queued by drawRotarySlider
+ * on a miss; finished strips are published under a lock and handed out as Image copies
+ * (reference-counted, so a lookup never copies pixels and eviction never invalidates a
+ * frame that is being drawn).
+ *
+ * Frames are software images (rasterised on this thread, not a GPU context's) and the
+ * cache is bounded by bytes, oldest strip evicted first. A strip larger than the whole
+ * budget is never rendered: that knob stays on the layered fallback.
+ */
+class ClaymoreTheme::KnobFilmstripRenderer : private juce::Thread
+{
+public:
+    KnobFilmstripRenderer() : juce::Thread ("Claymore Knob Filmstrips") {}
+
+    ~KnobFilmstripRenderer() override
+    {
+        stopThread (2000);
+    }
+
+    /** Message thread: copies the frame for sliderPos into dest, or queues the strip and
+        returns false. */
+    bool getFrame (const KnobKey& key, float sliderPos, juce::Image& dest)
+    {
+        const int frame = juce::jlimit (0, numKnobFrames - 1,
+                                        juce::roundToInt (sliderPos * (float) (numKnobFrames - 1)));
+        {
+            const juce::ScopedLock lock (stripLock);
+
+            for (const auto& strip : strips)
+            {
+                if (strip.key == key)
+                {
+                    dest = strip.frames[(size_t) frame];
+                    return true;
+                }
+            }
+
+            for (const auto& pending : pendingKeys)
+                if (pending == key)
+                    return false;
+
+            if (getStripBytes (key) > maxFilmstripBytes)
+                return false;
+
+            // A resize drag walks through many scales: only the latest waiting request
+            // per knob survives (front() is already rendering and is left alone)
+            if (pendingKeys.size() > 1)
+                pendingKeys.erase (std::remove_if (pendingKeys.begin() + 1, pendingKeys.end(),
+                                                   [&key] (const KnobKey& pending) { return pending.isSameKnob (key); }),
+                                   pendingKeys.end());
+
+            pendingKeys.push_back (key);
+        }
+
+        if (! isThreadRunning())
+            startThread (juce::Thread::Priority::low);
+
+        notify();
+        return false;
+    }
+
+private:
+    struct Filmstrip
+    {
+        KnobKey key;
+        std::vector<juce::Image> frames;
+        size_t bytes = 0;
+    };
+
+    static size_t getStripBytes (const KnobKey& key)
+    {
+        const auto width  = (size_t) juce::jmax (1, juce::roundToInt ((float) key.width  * key.scale));
+        const auto height = (size_t) juce::jmax (1, juce::roundToInt ((float) key.height * key.scale));
+        return (size_t) numKnobFrames * width * height * 4;
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            KnobKey key;
+            {
+                const juce::ScopedLock lock (stripLock);
+                if (! pendingKeys.empty())
+                    key = pendingKeys.front();
+            }
+
+            if (key.width <= 0 || key.height <= 0)
+            {
+                wait (-1);
+                continue;
+            }
+
+            Filmstrip strip { key, renderFrames (key), getStripBytes (key) };
+
+            const juce::ScopedLock lock (stripLock);
+            pendingKeys.erase (pendingKeys.begin());
+
+            // Incomplete when interrupted by shutdown — never publish a partial strip
+            if (static_cast<int> (strip.frames.size()) != numKnobFrames)
+                continue;
+
+            while (! strips.empty() && cachedBytes + strip.bytes > maxFilmstripBytes)
+            {
+                cachedBytes -= strips.front().bytes;
+                strips.erase (strips.begin());
+            }
+
+            cachedBytes += strip.bytes;
+            strips.push_back (std::move (strip));
+        }
+    }
+
+    /** Every frame = base layer, lit LEDs, knurl, cap layer, pointer (the drawRotarySlider order). */
+    std::vector<juce::Image> renderFrames (const KnobKey& key)
+    {
+        const auto base = renderKnobBaseLayer (key.width, key.height, key.scale, key.startAngle, key.endAngle);
+        const auto cap  = renderKnobCapLayer  (key.width, key.height, key.scale);
+        const KnobGeometry k (0.0f, 0.0f, key.width, key.height);
+        const auto toPhysical = juce::AffineTransform::scale (key.scale);
+
+        std::vector<juce::Image> frames;
+        frames.reserve ((size_t) numKnobFrames);
+
+        for (int i = 0; i < numKnobFrames && ! threadShouldExit(); ++i)
+        {
+            const float sliderPos = (float) i / (float) (numKnobFrames - 1);
+            const float angle     = key.startAngle + sliderPos * (key.endAngle - key.startAngle);
+
+            juce::Image frame (juce::Image::ARGB, base.getWidth(), base.getHeight(), true, juce::SoftwareImageType());
+            juce::Graphics fg (frame);
+
+            fg.drawImageAt (base, 0, 0);
+            {
+                juce::Graphics::ScopedSaveState state (fg);
+                fg.addTransform (toPhysical);
+                drawKnobLitDots (fg, k, sliderPos, key.startAngle, key.endAngle);
+                drawKnobKnurl (fg, k, angle);
+            }
+            fg.drawImageAt (cap, 0, 0);
+            fg.addTransform (toPhysical);
+            drawKnobPointer (fg, k, angle);
+
+            frames.push_back (std::move (frame));
+        }
+
+        return frames;
+    }
+
+    juce::CriticalSection  stripLock;
+    std::vector<Filmstrip> strips;
+    size_t                 cachedBytes = 0;   // sum of strips[].bytes
+    std::vector<KnobKey>   pendingKeys;   // front() is the strip being rendered
+
+    JUCE_DECLARE_NON_COPYABLE (KnobFilmstripRenderer)
+};
+
+//==============================================================================
+ClaymoreTheme::SharedResources::SharedResources()
+    : knobFilmstrips (std::make_unique<KnobFilmstripRenderer>())
+{
+    // Generate grain texture once (128x128 tile, dark speckling for light surface)
+    grainTexture = generateGrainTexture (128, 128, 1.0f);
+}
+
+ClaymoreTheme::SharedResources::~SharedResources() = default;
+
+const ClaymoreTheme::KnobLayers& ClaymoreTheme::getKnobLayers (const KnobKey& key)
+{
+    for (const auto& layers : knobLayerCache)
+        if (layers.key == key)
+            return layers;
+
+    KnobLayers layers;
+    layers.key  = key;
+    layers.base = renderKnobBaseLayer (key.width, key.height, key.scale, key.startAngle, key.endAngle);
+    layers.cap  = renderKnobCapLayer  (key.width, key.height, key.scale);
+
+    // A handful of knob sizes per editor; a scale change (monitor move) starts afresh
+    if (knobLayerCache.size() >= maxKnobLayerEntries)
+        knobLayerCache.clear();
+
+    knobLayerCache.push_back (std::move (layers));
+    return knobLayerCache.back();
+}
+
+void ClaymoreTheme::drawRotarySlider (juce::Graphics& g,
+                                       int x, int y, int width, int height,
+                                       float sliderPos,
+                                       float rotaryStartAngle,
+                                       float rotaryEndAngle,
+                                       juce::Slider& /*slider*/)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    const auto area = juce::Rectangle<int> (x, y, width, height).toFloat();
+    const KnobKey key { width, height, g.getInternalContext().getPhysicalPixelScaleFactor(),
+                        rotaryStartAngle, rotaryEndAngle };
+
+    // Fast path: one blit from the pre-rendered filmstrip
+    juce::Image frame;
+    if (shared->knobFilmstrips->getFrame (key, sliderPos, frame))
+    {
+        g.drawImage (frame, area);
+        return;
+    }
+
+    // Fallback while the strip renders: cached static layers + live moving parts
+    const KnobGeometry k ((float) x, (float) y, width, height);
+    const auto angle   = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
+    const auto& layers = getKnobLayers (key);
+
+    g.drawImage (layers.base, area);
+    drawKnobLitDots (g, k, sliderPos, rotaryStartAngle, rotaryEndAngle);
+    drawKnobKnurl (g, k, angle);
+    g.drawImage (layers.cap, area);
+    drawKnobPointer (g, k, angle);
 }
 
 //==============================================================================
@@ -311,12 +606,14 @@ void ClaymoreTheme::drawToggleButton (juce::Graphics& g,
     g.setColour (juce::Colour (0x18000000));
     g.drawRoundedRectangle (pillBounds, cornerRadius, 1.0f);
 
-    // LED indicator above pill — always visible, dormant when off
+    // LED indicator above pill — always visible, dormant when off.
+    // The editor sets the "gateOpen" property from metering: lit only while signal passes.
     {
         float ledSize = 6.0f;
         float ledX = pillBounds.getCentreX() - ledSize * 0.5f;
         float ledY = pillBounds.getY() - 6.0f - ledSize;
-        drawLEDIndicator (g, juce::Rectangle<float> (ledX, ledY, ledSize, ledSize), isOn);
+        const bool ledOn = isOn && static_cast<bool> (button.getProperties().getWithDefault ("gateOpen", true));
+        drawLEDIndicator (g, juce::Rectangle<float> (ledX, ledY, ledSize, ledSize), ledOn);
     }
 
     // Label below — lowercase
@@ -450,23 +747,56 @@ void ClaymoreTheme::drawPopupMenuItem (juce::Graphics& g, const juce::Rectangle<
 
 juce::Font ClaymoreTheme::getTitleFont (float height)
 {
-    return juce::Font { juce::FontOptions{}
-        .withTypeface (cormorantTypeface)
-        .withHeight (height) };
+    if (auto typeface = shared->fonts.getCormorant())
+        return juce::Font { juce::FontOptions{}.withTypeface (typeface).withHeight (height) };
+
+    return juce::Font { juce::FontOptions { juce::Font::getDefaultSerifFontName(), height, juce::Font::plain } };
 }
 
 juce::Font ClaymoreTheme::getKnobLabelFont (float height)
 {
-    return juce::Font { juce::FontOptions{}
-        .withTypeface (dmSansTypeface)
-        .withHeight (height) };
+    if (auto typeface = shared->fonts.getDMSans())
+        return juce::Font { juce::FontOptions{}.withTypeface (typeface).withHeight (height) };
+
+    return juce::Font { juce::FontOptions{}.withHeight (height) };
 }
 
 juce::Font ClaymoreTheme::getKnobValueFont (float height)
 {
-    return juce::Font { juce::FontOptions{}
-        .withTypeface (dmSansLightTypeface)
-        .withHeight (height) };
+    if (auto typeface = shared->fonts.getDMSansLight())
+        return juce::Font { juce::FontOptions{}.withTypeface (typeface).withHeight (height) };
+
+    return juce::Font { juce::FontOptions{}.withHeight (height) };
+}
+
+//==============================================================================
+// ClaymoreFonts — embedded typefaces, loaded on the message thread after the editor opens
+
+ClaymoreFonts::ClaymoreFonts()
+{
+    triggerAsyncUpdate();
+}
+
+ClaymoreFonts::~ClaymoreFonts()
+{
+    cancelPendingUpdate();
+}
+
+void ClaymoreFonts::handleAsyncUpdate()
+{
+    cormorant = juce::Typeface::createSystemTypefaceFor (
+        ClaymoreAssets::CormorantGaramond_ttf,
+        ClaymoreAssets::CormorantGaramond_ttfSize);
+
+    dmSans = juce::Typeface::createSystemTypefaceFor (
+        ClaymoreAssets::DMSansRegular_ttf,
+        ClaymoreAssets::DMSansRegular_ttfSize);
+
+    dmSansLight = juce::Typeface::createSystemTypefaceFor (
+        ClaymoreAssets::DMSansLight_ttf,
+        ClaymoreAssets::DMSansLight_ttfSize);
+
+    ready.store (true, std::memory_order_release);
 }
 
 //==============================================================================
@@ -2,6 +2,7 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "ClaymoreFonts.h"
 
 /**
  * ClaymoreTheme — custom LookAndFeel_V4 for the Claymore distortion plugin.
@@ -35,7 +36,7 @@ class ClaymoreTheme : public juce::LookAndFeel_V4
 {
 public:
     ClaymoreTheme();
-    ~ClaymoreTheme() override = default;
+    ~ClaymoreTheme() override;
 
     //==============================================================================
     // LookAndFeel overrides
@@ -71,11 +72,15 @@ public:
     //==============================================================================
     // Font helpers — JUCE 8 FontOptions API
     // Note: getLabelFont(Label&) is a virtual in LookAndFeel_V2 — use distinct names.
+    // Until the embedded typefaces have loaded these return the default serif / sans.
 
     juce::Font getTitleFont (float height);
     juce::Font getKnobLabelFont (float height);
     juce::Font getKnobValueFont  (float height);
 
+    /** True once the embedded typefaces are in use (see ClaymoreFonts). */
+    bool areFontsReady() const { return shared->fonts.isReady(); }
+
     //==============================================================================
     // Static helpers
 
@@ -87,15 +92,61 @@ public:
     /** Generate a tileable grain noise texture. Call once and cache. */
     static juce::Image generateGrainTexture (int w, int h, float opacity);
 
-    /** Returns the cached grain texture (128x128 ARGB tile). */
-    const juce::Image& getGrainTexture() const { return grainTexture; }
+    /** Returns the shared grain texture (128x128 ARGB tile). */
+    const juce::Image& getGrainTexture() const { return shared->grainTexture; }
 
 private:
-    juce::Typeface::Ptr cormorantTypeface;
-    juce::Typeface::Ptr dmSansTypeface;
-    juce::Typeface::Ptr dmSansLightTypeface;
-
-    juce::Image grainTexture;
+    /** Identifies one rendered knob: component size, rotary range and display scale. */
+    struct KnobKey
+    {
+        int   width = 0, height = 0;
+        float scale = 1.0f, startAngle = 0.0f, endAngle = 0.0f;
+
+        bool isSameKnob (const KnobKey& other) const
+        {
+            return width == other.width && height == other.height
+                && startAngle == other.startAngle && endAngle == other.endAngle;
+        }
+
+        bool operator== (const KnobKey& other) const
+        {
+            return isSameKnob (other) && scale == other.scale;
+        }
+    };
+
+    /** Static knob layers (fallback path until the filmstrip is ready), see drawRotarySlider. */
+    struct KnobLayers
+    {
+        KnobKey key;
+        juce::Image base;   // unlit LED arc, chassis cutout, drop shadow, skirt
+        juce::Image cap;    // cap shadow, cap, lip, vignette, outer rim
+    };
+
+    const KnobLayers& getKnobLayers (const KnobKey& key);
+
+    static constexpr size_t maxKnobLayerEntries = 16;
+    std::vector<KnobLayers> knobLayerCache;
+
+    // Full-knob filmstrips, rendered on a background thread (defined in the .cpp)
+    class KnobFilmstripRenderer;
+
+    /** Process-wide assets, created with the first editor and released with the last, so
+        N open instances load the fonts (asynchronously, see ClaymoreFonts), generate the
+        grain tile and render each knob filmstrip once. Only touched on the message thread
+        (the filmstrip renderer locks internally). */
+    struct SharedResources
+    {
+        SharedResources();
+        ~SharedResources();
+
+        ClaymoreFonts fonts;
+
+        juce::Image grainTexture;
+
+        std::unique_ptr<KnobFilmstripRenderer> knobFilmstrips;
+    };
+
+    juce::SharedResourcePointer<SharedResources> shared;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ClaymoreTheme)
 };
@@ -0,0 +1,468 @@
+#include <cmath>
+#include <limits>
+#include <map>
+#include "ReferenceChain.h"
+#include "TestSignals.h"
+#include "dsp/ClaymoreEngine.h"
+#include "dsp/fuzz/FuzzCore.h"
+#include "dsp/fuzz/FuzzTone.h"
+
+/**
+ * ClaymoreEquivalenceTests — the shipping DSP against the frozen scalar reference
+ * (ReferenceChain.h) on the same input and the same randomised automation.
+ *
+ * Usage: ClaymoreEquivalenceTests [options]          (exit code 1 if any case fails)
+ *
+ *   --stages=shaper,tone,engine,gate,gate-lookahead   what to compare (default: all)
+ *   --os=2,4,8              oversampling factors for the engine / gate stages
+ *   --rate=48000            sample rate of the synthesised signals
+ *   --seconds=2             length of each signal
+ *   --max-block=512         host block sizes are random in 1..max-block
+ *   --seed=1                signal + automation seed
+ *   --di=<file>             recorded guitar DI (wav/aiff/flac); default: synthetic plucks
+ *
+ * Accuracy tiers (a case fails if ANY metric is over its tier's limit):
+ *   exact        max abs 0,     rms 0,     null -inf dB
+ *   transparent  max abs 1e-5,  rms 1e-6,  null -100 dB      (default: shaper, tone, engine)
+ *   perceptual   max abs 1e-2,  rms 1e-3,  null -50 dB       (default: gate, gate-lookahead)
+ *
+ *   --tier=<tier>                     every stage
+ *   --tier-<stage>=<tier>             one stage, e.g. --tier-tone=exact
+ *   --<tier>-max-abs=<x>  --<tier>-max-rms=<x>  --<tier>-null-db=<dB>   move a tier's limits
+ *
+ * The gate stages default to perceptual because the hysteresis state machine is a
+ * threshold: a rounding change can legitimately flip it a sample early.
+ *
+ * Stages:
+ *   shaper          FuzzCore::processSample() at 2x the signal rate, per-block drive /
+ *                   clip / sag / tightness automation
+ *   tone            FuzzTone::applyTone(), tone / presence automation
+ *   engine          ClaymoreEngine::process(), gate off, all shaper + tone automation
+ *   gate            same with the classic pre-distortion gate, randomised hidden gate
+ *                   settings and threshold automation
+ *   gate-lookahead  same with the lookahead gate
+ */
+namespace
+{
+    //==========================================================================
+    struct Tier
+    {
+        double maxAbsError;
+        double maxRmsError;
+        double maxNullDepthDb;
+    };
+
+    struct Metrics
+    {
+        double      maxAbsError      = 0.0;
+        double      errorSquares     = 0.0;
+        double      referenceSquares = 0.0;
+        juce::int64 count            = 0;
+
+        void add (const float* reference, const float* test, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double error = static_cast<double> (test[i]) - static_cast<double> (reference[i]);
+                maxAbsError       = juce::jmax (maxAbsError, std::abs (error));
+                errorSquares     += error * error;
+                referenceSquares += static_cast<double> (reference[i]) * static_cast<double> (reference[i]);
+            }
+            count += numSamples;
+        }
+
+        double getRmsError() const { return count > 0 ? std::sqrt (errorSquares / static_cast<double> (count)) : 0.0; }
+
+        /** Error energy relative to the reference, in dB (-inf = identical). */
+        double getNullDepthDb() const
+        {
+            if (errorSquares <= 0.0)
+                return -std::numeric_limits<double>::infinity();
+            if (referenceSquares <= 0.0)
+                return std::numeric_limits<double>::infinity();
+            return 10.0 * std::log10 (errorSquares / referenceSquares);
+        }
+
+        bool passes (const Tier& tier) const
+        {
+            return maxAbsError <= tier.maxAbsError
+                && getRmsError() <= tier.maxRmsError
+                && getNullDepthDb() <= tier.maxNullDepthDb;
+        }
+    };
+
+    //==========================================================================
+    struct Options
+    {
+        juce::StringArray stages              { "shaper", "tone", "engine", "gate", "gate-lookahead" };
+        std::vector<int>  oversamplingIndices { 0, 1, 2 };
+        double      sampleRate   = 48000.0;
+        double      seconds      = 2.0;
+        int         maxBlockSize = 512;
+        juce::int64 seed         = 1;
+        juce::File  diFile;
+
+        std::map<juce::String, Tier> tiers
+        {
+            { "exact",       { 0.0,  0.0,  -std::numeric_limits<double>::infinity() } },
+            { "transparent", { 1e-5, 1e-6, -100.0 } },
+            { "perceptual",  { 1e-2, 1e-3, -50.0 } }
+        };
+
+        std::map<juce::String, juce::String> stageTiers
+        {
+            { "shaper", "transparent" }, { "tone", "transparent" }, { "engine", "transparent" },
+            { "gate", "perceptual" },    { "gate-lookahead", "perceptual" }
+        };
+    };
+
+    /**
+     * Block-by-block parameter automation shared by both implementations: a random walk
+     * with occasional jumps, and about a third of the blocks left untouched so the settled
+     * (non-ramping) code paths run too.
+     */
+    struct Automation
+    {
+        float drive           = 0.5f;
+        int   clipType        = 0;
+        float tightness       = 0.0f;
+        float sag             = 0.0f;
+        float tone            = 0.5f;
+        float presence        = 0.5f;
+        float gateThresholdDB = -40.0f;
+
+        void advance (juce::Random& rng)
+        {
+            if (rng.nextInt (3) == 0)
+                return;
+
+            auto walk = [&rng] (float& value, float low, float high, float step)
+            {
+                value = rng.nextInt (50) == 0 ? low + (high - low) * rng.nextFloat()
+                                              : juce::jlimit (low, high, value + step * (2.0f * rng.nextFloat() - 1.0f));
+            };
+
+            walk (drive,           0.0f,   1.0f,  0.05f);
+            walk (tightness,       0.0f,   1.0f,  0.05f);
+            walk (sag,             0.0f,   1.0f,  0.05f);
+            walk (tone,            0.0f,   1.0f,  0.05f);
+            walk (presence,        0.0f,   1.0f,  0.05f);
+            walk (gateThresholdDB, -60.0f, -10.0f, 2.0f);
+
+            if (rng.nextInt (40) == 0)
+                clipType = rng.nextInt (8);
+        }
+    };
+
+    /**
+     * Runs `process (reference, test)` over the signal in random-sized host blocks.
+     * Both buffers hold a copy of the same input block; the callback processes them in
+     * place and the outputs are accumulated into the returned metrics.
+     */
+    template <typename ProcessFn>
+    Metrics runBlocks (const Equivalence::TestSignal& signal, int maxBlockSize, juce::Random& rng, ProcessFn&& process)
+    {
+        const int numChannels = signal.audio.getNumChannels();
+        const int numSamples  = signal.audio.getNumSamples();
+
+        juce::AudioBuffer<float> referenceStorage (numChannels, maxBlockSize);
+        juce::AudioBuffer<float> testStorage (numChannels, maxBlockSize);
+        Metrics metrics;
+
+        for (int position = 0; position < numSamples;)
+        {
+            const int blockSize = juce::jmin (numSamples - position, 1 + rng.nextInt (maxBlockSize));
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                referenceStorage.copyFrom (ch, 0, signal.audio, ch, position, blockSize);
+                testStorage.copyFrom (ch, 0, signal.audio, ch, position, blockSize);
+            }
+
+            juce::AudioBuffer<float> reference (referenceStorage.getArrayOfWritePointers(), numChannels, blockSize);
+            juce::AudioBuffer<float> test (testStorage.getArrayOfWritePointers(), numChannels, blockSize);
+            process (reference, test);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                metrics.add (reference.getReadPointer (ch), test.getReadPointer (ch), blockSize);
+
+            position += blockSize;
+        }
+
+        return metrics;
+    }
+
+    //==========================================================================
+    Metrics compareShaper (const Equivalence::TestSignal& signal, const Options& options, juce::Random& rng)
+    {
+        const double shaperRate  = signal.sampleRate * 2.0;
+        const int    numChannels = signal.audio.getNumChannels();
+
+        std::vector<FuzzCoreState>          testStates (static_cast<size_t> (numChannels));
+        std::vector<Reference::ShaperState> referenceStates (static_cast<size_t> (numChannels));
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            testStates[static_cast<size_t> (ch)].prepare (shaperRate);
+            referenceStates[static_cast<size_t> (ch)].prepare (shaperRate);
+        }
+
+        Automation automation;
+
+        return runBlocks (signal, options.maxBlockSize, rng, [&] (juce::AudioBuffer<float>& reference, juce::AudioBuffer<float>& test)
+        {
+            automation.advance (rng);
+            const float drive  = FuzzConfig::mapDrive (automation.drive);
+            const float cutoff = 20.0f + automation.tightness * 780.0f;
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& testState      = testStates[static_cast<size_t> (ch)];
+                auto& referenceState = referenceStates[static_cast<size_t> (ch)];
+                testState.tightnessFilter.setCutoffFrequency (cutoff);
+                referenceState.tightnessFilter.setCutoffFrequency (cutoff);
+
+                auto* testData      = test.getWritePointer (ch);
+                auto* referenceData = reference.getWritePointer (ch);
+                for (int s = 0; s < test.getNumSamples(); ++s)
+                {
+                    testData[s]      = FuzzCore::processSample (testData[s], drive, automation.clipType, automation.sag, testState);
+                    referenceData[s] = Reference::shapeSample (referenceData[s], drive, automation.clipType, automation.sag, referenceState);
+                }
+            }
+        });
+    }
+
+    Metrics compareTone (const Equivalence::TestSignal& signal, const Options& options, juce::Random& rng)
+    {
+        const juce::dsp::ProcessSpec spec { signal.sampleRate, static_cast<juce::uint32> (options.maxBlockSize),
+                                            static_cast<juce::uint32> (signal.audio.getNumChannels()) };
+        FuzzTone tone;
+        tone.prepare (spec);
+        Reference::Tone referenceTone;
+        referenceTone.prepare (spec);
+
+        Automation automation;
+
+        return runBlocks (signal, options.maxBlockSize, rng, [&] (juce::AudioBuffer<float>& reference, juce::AudioBuffer<float>& test)
+        {
+            automation.advance (rng);
+            tone.setTone (automation.tone);
+            tone.setPresence (automation.presence);
+            referenceTone.setTone (automation.tone);
+            referenceTone.setPresence (automation.presence);
+
+            tone.applyTone (test);
+            referenceTone.process (reference);
+        });
+    }
+
+    Metrics compareEngine (const Equivalence::TestSignal& signal, const Options& options, juce::Random& rng,
+                           int osIndex, bool gateEnabled, bool lookahead)
+    {
+        const juce::dsp::ProcessSpec spec { signal.sampleRate, static_cast<juce::uint32> (options.maxBlockSize),
+                                            static_cast<juce::uint32> (signal.audio.getNumChannels()) };
+
+        // Hidden gate settings are fixed per run, randomised within their setter ranges
+        Reference::GateSettings gate;
+        if (gateEnabled)
+        {
+            gate.attackMs     = 0.2f + 20.0f * rng.nextFloat();
+            gate.releaseMs    = 10.0f + 490.0f * rng.nextFloat();
+            gate.hysteresisDB = 12.0f * rng.nextFloat();
+            gate.rangeDB      = -100.0f + 80.0f * rng.nextFloat();
+            gate.sidechainHz  = 40.0f + 600.0f * rng.nextFloat();
+            gate.lookahead    = lookahead;
+        }
+
+        ClaymoreEngine engine;
+        engine.prepare (spec);
+        engine.setOversamplingFactor (osIndex, ClaymoreEngine::OversamplingSwitch::immediate);
+        engine.setGateAttack (gate.attackMs);
+        engine.setGateRelease (gate.releaseMs);
+        engine.setGateHysteresis (gate.hysteresisDB);
+        engine.setGateRange (gate.rangeDB);
+        engine.setGateSidechainHPF (gate.sidechainHz);
+        engine.setGateLookahead (gate.lookahead);
+
+        Reference::Engine referenceEngine;
+        referenceEngine.prepare (spec, osIndex, gate);
+
+        Automation automation;
+
+        return runBlocks (signal, options.maxBlockSize, rng, [&] (juce::AudioBuffer<float>& reference, juce::AudioBuffer<float>& test)
+        {
+            automation.advance (rng);
+
+            ClaymoreEngine::Parameters p;
+            p.drive           = automation.drive;
+            p.clipType        = automation.clipType;
+            p.tightness       = automation.tightness;
+            p.sag             = automation.sag;
+            p.tone            = automation.tone;
+            p.presence        = automation.presence;
+            p.gateEnabled     = gateEnabled;
+            p.gateThresholdDB = automation.gateThresholdDB;
+            engine.applyParameters (p);
+
+            Reference::EngineParameters r;
+            r.drive           = automation.drive;
+            r.clipType        = automation.clipType;
+            r.tightness       = automation.tightness;
+            r.sag             = automation.sag;
+            r.tone            = automation.tone;
+            r.presence        = automation.presence;
+            r.gateEnabled     = gateEnabled;
+            r.gateThresholdDB = automation.gateThresholdDB;
+            referenceEngine.setParameters (r);
+
+            engine.process (test);
+            referenceEngine.process (reference);
+        });
+    }
+
+    //==========================================================================
+    template <typename T>
+    std::vector<T> parseList (const juce::String& text)
+    {
+        std::vector<T> values;
+        for (const auto& token : juce::StringArray::fromTokens (text, ",", ""))
+            if (token.trim().isNotEmpty())
+                values.push_back (static_cast<T> (token.trim().getDoubleValue()));
+        return values;
+    }
+
+    bool parseOptions (const juce::ArgumentList& args, Options& options)
+    {
+        auto value = [&args] (const juce::String& option, double fallback)
+        {
+            return args.containsOption (option) ? args.getValueForOption (option).getDoubleValue() : fallback;
+        };
+
+        if (args.containsOption ("--stages"))
+            options.stages = juce::StringArray::fromTokens (args.getValueForOption ("--stages"), ",", "");
+
+        if (args.containsOption ("--os"))
+        {
+            options.oversamplingIndices.clear();
+            for (const int factor : parseList<int> (args.getValueForOption ("--os")))
+                if (factor == 2 || factor == 4 || factor == 8)
+                    options.oversamplingIndices.push_back (factor == 2 ? 0 : (factor == 4 ? 1 : 2));
+        }
+
+        options.sampleRate   = juce::jmax (8000.0, value ("--rate", options.sampleRate));
+        options.seconds      = juce::jmax (0.01, value ("--seconds", options.seconds));
+        options.maxBlockSize = juce::jmax (1, static_cast<int> (value ("--max-block", options.maxBlockSize)));
+        options.seed         = static_cast<juce::int64> (value ("--seed", static_cast<double> (options.seed)));
+
+        if (args.containsOption ("--di"))
+            options.diFile = juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--di"));
+
+        for (auto& [name, tier] : options.tiers)
+        {
+            tier.maxAbsError    = value ("--" + name + "-max-abs", tier.maxAbsError);
+            tier.maxRmsError    = value ("--" + name + "-max-rms", tier.maxRmsError);
+            tier.maxNullDepthDb = value ("--" + name + "-null-db", tier.maxNullDepthDb);
+        }
+
+        for (auto& [stage, tierName] : options.stageTiers)
+        {
+            if (args.containsOption ("--tier"))
+                tierName = args.getValueForOption ("--tier");
+            if (args.containsOption ("--tier-" + stage))
+                tierName = args.getValueForOption ("--tier-" + stage);
+
+            if (options.tiers.count (tierName) == 0)
+            {
+                std::fprintf (stderr, "Unknown accuracy tier '%s' (exact, transparent, perceptual)\n", tierName.toRawUTF8());
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+
+    Options options;
+    if (! parseOptions (args, options))
+        return 1;
+
+    juce::ScopedNoDenormals noDenormals;
+
+    const auto signals = Equivalence::makeTestSignals (options.sampleRate, options.seconds, options.seed, options.diFile);
+
+    std::printf ("== Equivalence: shipping DSP vs frozen reference (%.2f s per signal, blocks 1..%d, seed %lld) ==\n",
+                 options.seconds, options.maxBlockSize, static_cast<long long> (options.seed));
+    std::printf ("%-14s %-18s %12s %12s %10s %-12s %s\n",
+                 "signal", "stage", "max abs", "rms error", "null dB", "tier", "result");
+
+    int failures = 0, cases = 0;
+
+    auto report = [&] (const Equivalence::TestSignal& signal, const juce::String& stage, const juce::String& stageName,
+                       const Metrics& metrics)
+    {
+        const auto& tierName = options.stageTiers.at (stage);
+        const bool  passed   = metrics.passes (options.tiers.at (tierName));
+
+        std::printf ("%-14s %-18s %12.3e %12.3e %10.1f %-12s %s\n",
+                     signal.name.toRawUTF8(), stageName.toRawUTF8(),
+                     metrics.maxAbsError, metrics.getRmsError(), metrics.getNullDepthDb(),
+                     tierName.toRawUTF8(), passed ? "ok" : "FAIL");
+
+        ++cases;
+        if (! passed)
+            ++failures;
+    };
+
+    for (size_t i = 0; i < signals.size(); ++i)
+    {
+        const auto& signal = signals[i];
+
+        // Each (signal, stage) gets its own automation stream, independent of which stages run
+        auto caseRandom = [&] (int stageIndex)
+        {
+            return juce::Random (options.seed * 1000003 + static_cast<juce::int64> (i) * 101 + stageIndex);
+        };
+
+        if (options.stages.contains ("shaper"))
+        {
+            auto rng = caseRandom (0);
+            report (signal, "shaper", "shaper", compareShaper (signal, options, rng));
+        }
+
+        if (options.stages.contains ("tone"))
+        {
+            auto rng = caseRandom (1);
+            report (signal, "tone", "tone", compareTone (signal, options, rng));
+        }
+
+        for (const int osIndex : options.oversamplingIndices)
+        {
+            const juce::String factor = "/" + juce::String (2 << osIndex) + "x";
+
+            if (options.stages.contains ("engine"))
+            {
+                auto rng = caseRandom (2 + osIndex);
+                report (signal, "engine", "engine" + factor, compareEngine (signal, options, rng, osIndex, false, false));
+            }
+
+            if (options.stages.contains ("gate"))
+            {
+                auto rng = caseRandom (5 + osIndex);
+                report (signal, "gate", "gate" + factor, compareEngine (signal, options, rng, osIndex, true, false));
+            }
+
+            if (options.stages.contains ("gate-lookahead"))
+            {
+                auto rng = caseRandom (8 + osIndex);
+                report (signal, "gate-lookahead", "gate-lookahead" + factor, compareEngine (signal, options, rng, osIndex, true, true));
+            }
+        }
+    }
+
+    std::printf ("\n%d of %d cases within tier\n", cases - failures, cases);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,442 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <juce_dsp/juce_dsp.h>
+
+/**
+ * Frozen scalar reference of the Claymore DSP chain — DO NOT OPTIMISE.
+ *
+ * A straight, sample-by-sample copy of the shipping code as of the equivalence harness's
+ * introduction: FuzzCore::processSample() (clip + sag), the ShaperLane smoothers,
+ * FuzzTone::applyTone(), and ClaymoreEngine's hysteresis gate (classic and lookahead).
+ * Nothing here includes or calls the code under test; the shipping DSP may be rewritten
+ * freely as long as EquivalenceMain keeps it within its accuracy tier of this file.
+ *
+ * Deliberate simplifications (behaviour-neutral for the harness):
+ *   - one oversampling rate per run — no crossfaded rate switching
+ *   - the tone filters always take the per-sample parameter path (the shipping code's
+ *     settled fast path computes the same thing)
+ *   - the lookahead window maximum is a plain scan instead of a monotonic deque
+ */
+namespace Reference
+{
+    //==========================================================================
+    // Shaper (FuzzCore)
+
+    struct ShaperState
+    {
+        juce::dsp::FirstOrderTPTFilter<float> slewFilter;
+        juce::dsp::FirstOrderTPTFilter<float> tightnessFilter;
+        float envelopeValue = 0.0f;
+
+        void prepare (double sampleRate)
+        {
+            juce::dsp::ProcessSpec monoSpec { sampleRate, 1, 1 };
+
+            slewFilter.prepare (monoSpec);
+            slewFilter.setType (juce::dsp::FirstOrderTPTFilterType::lowpass);
+            slewFilter.setCutoffFrequency (3000.0f);
+
+            tightnessFilter.prepare (monoSpec);
+            tightnessFilter.setType (juce::dsp::FirstOrderTPTFilterType::highpass);
+            tightnessFilter.setCutoffFrequency (20.0f);
+
+            envelopeValue = 0.0f;
+        }
+    };
+
+    /** drive = mapped gain (1–40), clipType = ClipType index, sag 0–1. */
+    inline float shapeSample (float x, float drive, int clipType, float sag, ShaperState& state)
+    {
+        x = state.tightnessFilter.processSample (0, x);
+
+        const float gained = x * drive;
+
+        const float slewCutoff = 3000.0f * (1.0f - (drive - 1.0f) / 78.0f);
+        state.slewFilter.setCutoffFrequency (juce::jmax (1500.0f, slewCutoff));
+        const float slewed = state.slewFilter.processSample (0, gained);
+
+        // Envelope follower: Germanium (1) and Asymmetric (4) only
+        if (clipType == 1 || clipType == 4)
+        {
+            const float absInput = std::abs (x);
+            if (absInput > state.envelopeValue)
+                state.envelopeValue += 0.01f * (absInput - state.envelopeValue);
+            else
+                state.envelopeValue += 0.001f * (absInput - state.envelopeValue);
+        }
+
+        const float envelope = state.envelopeValue;
+        float clipped = 0.0f;
+
+        switch (clipType)
+        {
+            case 1:     // Germanium
+            {
+                const float biased = slewed + envelope * 0.8f;
+                clipped = biased / (1.0f + std::abs (biased));
+                break;
+            }
+            case 2:     // LED
+                clipped = juce::jlimit (-1.7f, 1.7f, slewed) / 1.7f;
+                break;
+            case 3:     // MOSFET
+                clipped = std::tanh (slewed);
+                break;
+            case 4:     // Asymmetric
+                if (slewed > 0.0f)
+                    clipped = juce::jmin (slewed, 0.6f) / 0.6f;
+                else
+                    clipped = juce::jmax (slewed, -0.3f) / 0.3f;
+                clipped += envelope * 0.15f;
+                clipped = juce::jlimit (-1.0f, 1.0f, clipped);
+                break;
+            case 5:     // OpAmp
+            {
+                const float s = juce::jlimit (-1.5f, 1.5f, slewed);
+                clipped = s - (s * s * s) / 3.0f;
+                clipped *= (2.0f / 3.0f);
+                clipped *= 1.5f;
+                break;
+            }
+            case 6:     // Foldback
+            {
+                float s = slewed;
+                while (s > 1.0f || s < -1.0f)
+                {
+                    if (s > 1.0f)  s = 2.0f - s;
+                    if (s < -1.0f) s = -2.0f - s;
+                }
+                clipped = s;
+                break;
+            }
+            case 7:     // Rectifier
+                clipped = (slewed > 0.0f) ? slewed : 0.0f;
+                clipped = clipped * 2.0f - 1.0f;
+                clipped = juce::jlimit (-1.0f, 1.0f, clipped);
+                break;
+            default:    // Silicon (0) and fallback
+                clipped = juce::jlimit (-0.6f, 0.6f, slewed) / 0.6f;
+                break;
+        }
+
+        if (sag > 0.0f)
+        {
+            const float sagThreshold = 0.3f * sag;
+            const float absClipped   = std::abs (clipped);
+            if (absClipped < sagThreshold)
+            {
+                const float ratio = absClipped / juce::jmax (sagThreshold, 0.001f);
+                clipped = clipped * ratio * ratio;
+            }
+            clipped *= 1.0f + sag * 0.5f;
+        }
+
+        return clipped;
+    }
+
+    //==========================================================================
+    // Tone (FuzzTone): Rat LP 2–20 kHz → presence shelf ±6 dB @ 4 kHz → 20 Hz DC blocker
+
+    class Tone
+    {
+    public:
+        void prepare (const juce::dsp::ProcessSpec& spec)
+        {
+            sampleRate  = spec.sampleRate;
+            numChannels = juce::jmin (maxChannels, static_cast<int> (spec.numChannels));
+
+            toneFilter.prepare (spec);
+            toneFilter.setType (juce::dsp::FirstOrderTPTFilterType::lowpass);
+
+            setPresenceCoefficients (0.5f);
+            *dcCoefficients = *juce::dsp::IIR::Coefficients<float>::makeFirstOrderHighPass (sampleRate, 20.0f);
+
+            for (int ch = 0; ch < maxChannels; ++ch)
+            {
+                presenceFilter[ch].coefficients = presenceCoefficients;
+                presenceFilter[ch].prepare (spec);
+                dcBlocker[ch].coefficients = dcCoefficients;
+                dcBlocker[ch].prepare (spec);
+            }
+
+            toneSmoother.reset (sampleRate, 0.005);
+            toneSmoother.setCurrentAndTargetValue (0.5f);
+            presenceSmoother.reset (sampleRate, 0.005);
+            presenceSmoother.setCurrentAndTargetValue (0.5f);
+            appliedTone = -1.0f;
+        }
+
+        void setTone     (float tone)     { toneSmoother.setTargetValue (tone); }
+        void setPresence (float presence) { presenceSmoother.setTargetValue (presence); }
+
+        void process (juce::AudioBuffer<float>& buffer)
+        {
+            const int chCount = juce::jmin (numChannels, buffer.getNumChannels());
+
+            for (int s = 0; s < buffer.getNumSamples(); ++s)
+            {
+                const float tone     = toneSmoother.getNextValue();
+                const float presence = presenceSmoother.getNextValue();
+
+                if (presence != appliedPresence)
+                    setPresenceCoefficients (presence);
+
+                if (tone != appliedTone)
+                {
+                    appliedTone = tone;
+                    toneFilter.setCutoffFrequency (2000.0f + tone * 18000.0f);
+                }
+
+                for (int ch = 0; ch < chCount; ++ch)
+                {
+                    float x = buffer.getSample (ch, s);
+                    x = toneFilter.processSample (ch, x);
+                    x = presenceFilter[ch].processSample (x);
+                    buffer.setSample (ch, s, dcBlocker[ch].processSample (x));
+                }
+            }
+
+            for (int ch = 0; ch < chCount; ++ch)
+            {
+                presenceFilter[ch].snapToZero();
+                dcBlocker[ch].snapToZero();
+            }
+        }
+
+    private:
+        static constexpr int maxChannels = 8;
+
+        void setPresenceCoefficients (float presence)
+        {
+            appliedPresence = presence;
+            const float gain = juce::Decibels::decibelsToGain ((presence - 0.5f) * 12.0f);
+            *presenceCoefficients = juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf (sampleRate, 4000.0f, 0.707f, gain);
+        }
+
+        juce::dsp::FirstOrderTPTFilter<float> toneFilter;
+        juce::dsp::IIR::Coefficients<float>::Ptr presenceCoefficients { new juce::dsp::IIR::Coefficients<float> (1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f) };
+        juce::dsp::IIR::Coefficients<float>::Ptr dcCoefficients       { new juce::dsp::IIR::Coefficients<float> (1.0f, 0.0f, 1.0f, 0.0f) };
+        juce::dsp::IIR::Filter<float> presenceFilter[maxChannels];
+        juce::dsp::IIR::Filter<float> dcBlocker[maxChannels];
+
+        juce::SmoothedValue<float> toneSmoother, presenceSmoother;
+        float appliedTone = -1.0f, appliedPresence = -1.0f;
+
+        double sampleRate  = 44100.0;
+        int    numChannels = 2;
+    };
+
+    //==========================================================================
+    // Engine: gate → upsample → shaper → downsample → tone (→ lookahead gate gain)
+
+    struct EngineParameters
+    {
+        float drive           = 0.5f;
+        int   clipType        = 0;
+        float tightness       = 0.0f;
+        float sag             = 0.0f;
+        float tone            = 0.5f;
+        float presence        = 0.5f;
+        bool  gateEnabled     = false;
+        float gateThresholdDB = -40.0f;
+    };
+
+    struct GateSettings
+    {
+        float attackMs      = 1.0f;
+        float releaseMs     = 80.0f;
+        float hysteresisDB  = 4.0f;
+        float rangeDB       = -60.0f;
+        float sidechainHz   = 150.0f;
+        bool  lookahead     = false;
+    };
+
+    class Engine
+    {
+    public:
+        /** osIndex: 0 = 2x, 1 = 4x, 2 = 8x (fixed for the run). */
+        void prepare (const juce::dsp::ProcessSpec& spec, int osIndex, const GateSettings& gateSettings)
+        {
+            sampleRate   = spec.sampleRate;
+            numChannels  = static_cast<int> (spec.numChannels);
+            maxBlockSize = static_cast<int> (spec.maximumBlockSize);
+            gate         = gateSettings;
+
+            oversampling = std::make_unique<juce::dsp::Oversampling<float>> (
+                static_cast<size_t> (numChannels), static_cast<size_t> (osIndex + 1),
+                juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, false);
+            oversampling->initProcessing (static_cast<size_t> (maxBlockSize));
+
+            const double osRate = sampleRate * std::pow (2.0, osIndex + 1);
+            shaperStates.resize (static_cast<size_t> (numChannels));
+            for (auto& state : shaperStates)
+                state.prepare (osRate);
+
+            driveSmoother.reset (osRate, 0.010);
+            tightnessSmoother.reset (osRate, 0.005);
+            sagSmoother.reset (osRate, 0.005);
+            driveSmoother.setCurrentAndTargetValue (params.drive);
+            tightnessSmoother.setCurrentAndTargetValue (params.tightness);
+            sagSmoother.setCurrentAndTargetValue (params.sag);
+
+            tone.prepare (spec);
+
+            juce::dsp::ProcessSpec monoSpec { sampleRate, spec.maximumBlockSize, 1 };
+            sidechainHPF.resize (static_cast<size_t> (numChannels));
+            for (auto& hpf : sidechainHPF)
+            {
+                hpf.prepare (monoSpec);
+                hpf.setType (juce::dsp::FirstOrderTPTFilterType::highpass);
+                hpf.setCutoffFrequency (gate.sidechainHz);
+            }
+
+            attackCoeff  = std::exp (-1.0f / (static_cast<float> (sampleRate) * (gate.attackMs  / 1000.0f)));
+            releaseCoeff = std::exp (-1.0f / (static_cast<float> (sampleRate) * (gate.releaseMs / 1000.0f)));
+
+            gateEnvelope = 0.0f;
+            gateIsOpen   = false;
+            gateSmoother.reset (static_cast<float> (sampleRate), 0.001);
+            gateSmoother.setCurrentAndTargetValue (1.0f);
+            gateGains.assign (static_cast<size_t> (maxBlockSize), 1.0f);
+            peakHistory.clear();
+        }
+
+        void setParameters (const EngineParameters& p)
+        {
+            // A disabled gate holds no state (the shipping engine resets it on disable)
+            if (! p.gateEnabled)
+            {
+                gateIsOpen   = false;
+                gateEnvelope = 0.0f;
+                gateSmoother.setCurrentAndTargetValue (1.0f);
+                peakHistory.clear();
+            }
+
+            params      = p;
+            gateEnabled = p.gateEnabled;
+        }
+
+        float getLatencyInSamples() const { return oversampling->getLatencyInSamples(); }
+
+        void process (juce::AudioBuffer<float>& buffer)
+        {
+            const int chCount    = juce::jmin (numChannels, buffer.getNumChannels());
+            const int numSamples = buffer.getNumSamples();
+
+            const float openThreshold  = juce::jlimit (-60.0f, -10.0f, params.gateThresholdDB);
+            const float openLinear     = juce::Decibels::decibelsToGain (openThreshold);
+            const float closeLinear    = juce::Decibels::decibelsToGain (openThreshold - gate.hysteresisDB);
+            const float rangeGain      = juce::Decibels::decibelsToGain (gate.rangeDB);
+
+            const bool lookahead = gateEnabled && gate.lookahead && numSamples <= maxBlockSize;
+            const int  window    = juce::jlimit (0, 256, static_cast<int> (getLatencyInSamples())) + 1;
+
+            // 1. Gate (classic: applied here; lookahead: gains computed here, applied in 6.)
+            if (gateEnabled)
+            {
+                for (int s = 0; s < numSamples; ++s)
+                {
+                    float peak = 0.0f;
+                    for (int ch = 0; ch < chCount; ++ch)
+                        peak = juce::jmax (peak, std::abs (sidechainHPF[static_cast<size_t> (ch)].processSample (0, buffer.getSample (ch, s))));
+
+                    if (lookahead)
+                    {
+                        peakHistory.push_back (peak);
+                        if (static_cast<int> (peakHistory.size()) > 257)
+                            peakHistory.erase (peakHistory.begin());
+
+                        float windowPeak = 0.0f;
+                        const int count = juce::jmin (window, static_cast<int> (peakHistory.size()));
+                        for (int i = 0; i < count; ++i)
+                            windowPeak = juce::jmax (windowPeak, peakHistory[peakHistory.size() - 1 - static_cast<size_t> (i)]);
+                        peak = windowPeak;
+                    }
+
+                    if (peak > gateEnvelope)
+                        gateEnvelope = attackCoeff * gateEnvelope + (1.0f - attackCoeff) * peak;
+                    else
+                        gateEnvelope = releaseCoeff * gateEnvelope + (1.0f - releaseCoeff) * peak;
+
+                    if (! gateIsOpen && gateEnvelope >= openLinear)
+                        gateIsOpen = true;
+                    else if (gateIsOpen && gateEnvelope < closeLinear)
+                        gateIsOpen = false;
+
+                    gateSmoother.setTargetValue (gateIsOpen ? 1.0f : rangeGain);
+                    const float gain = gateSmoother.getNextValue();
+
+                    if (lookahead)
+                        gateGains[static_cast<size_t> (s)] = gain;
+                    else
+                        for (int ch = 0; ch < chCount; ++ch)
+                            buffer.setSample (ch, s, buffer.getSample (ch, s) * gain);
+                }
+            }
+
+            // 2–4. Upsample → shaper → downsample
+            juce::dsp::AudioBlock<float> block (buffer);
+            auto upBlock = oversampling->processSamplesUp (block);
+            const int upSamples = static_cast<int> (upBlock.getNumSamples());
+
+            driveSmoother.setTargetValue (juce::jlimit (0.0f, 1.0f, params.drive));
+            tightnessSmoother.setTargetValue (juce::jlimit (0.0f, 1.0f, params.tightness));
+            sagSmoother.setTargetValue (juce::jlimit (0.0f, 1.0f, params.sag));
+            const int clipType = juce::jlimit (0, 7, params.clipType);
+
+            for (int ch = 0; ch < chCount; ++ch)
+            {
+                auto* data = upBlock.getChannelPointer (static_cast<size_t> (ch));
+                auto& state = shaperStates[static_cast<size_t> (ch)];
+
+                for (int s = 0; s < upSamples; ++s)
+                {
+                    const float drv   = ch == 0 ? driveSmoother.getNextValue()     : driveSmoother.getCurrentValue();
+                    const float tight = ch == 0 ? tightnessSmoother.getNextValue() : tightnessSmoother.getCurrentValue();
+                    const float sg    = ch == 0 ? sagSmoother.getNextValue()       : sagSmoother.getCurrentValue();
+
+                    state.tightnessFilter.setCutoffFrequency (20.0f + tight * 780.0f);
+                    data[s] = shapeSample (data[s], 1.0f + drv * 39.0f, clipType, sg, state) * 0.30f;
+                }
+            }
+
+            oversampling->processSamplesDown (block);
+
+            // 5. Tone
+            tone.setTone (juce::jlimit (0.0f, 1.0f, params.tone));
+            tone.setPresence (juce::jlimit (0.0f, 1.0f, params.presence));
+            tone.process (buffer);
+
+            // 6. Lookahead gate gain on the (latency-delayed) output
+            if (lookahead)
+                for (int ch = 0; ch < chCount; ++ch)
+                    for (int s = 0; s < numSamples; ++s)
+                        buffer.setSample (ch, s, buffer.getSample (ch, s) * gateGains[static_cast<size_t> (s)]);
+        }
+
+    private:
+        std::unique_ptr<juce::dsp::Oversampling<float>> oversampling;
+        std::vector<ShaperState> shaperStates;
+        juce::SmoothedValue<float> driveSmoother, tightnessSmoother, sagSmoother;
+        Tone tone;
+
+        EngineParameters params;
+        GateSettings     gate;
+        bool  gateEnabled   = false;
+        bool  gateIsOpen    = false;
+        float gateEnvelope  = 0.0f;
+        float attackCoeff   = 0.0f;
+        float releaseCoeff  = 0.0f;
+        juce::SmoothedValue<float> gateSmoother;
+        std::vector<juce::dsp::FirstOrderTPTFilter<float>> sidechainHPF;
+        std::vector<float> gateGains;
+        std::vector<float> peakHistory;
+
+        double sampleRate   = 44100.0;
+        int    numChannels  = 2;
+        int    maxBlockSize = 512;
+    };
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <juce_audio_formats/juce_audio_formats.h>
+
+/**
+ * Deterministic stimulus set for the equivalence harness: every signal is stereo, built
+ * from a fixed seed, so a failing case reproduces exactly.
+ *
+ *   sweep    — 20 Hz → 20 kHz exponential sine sweep, -6 dBFS
+ *   noise    — white noise, -12 dBFS
+ *   impulses — single-sample ±0.9 clicks on silence (gate open/close, filter ringing)
+ *   guitar   — a recorded guitar DI (--di=<file>), or a synthetic plucked-string DI
+ */
+namespace Equivalence
+{
+    struct TestSignal
+    {
+        juce::String name;
+        double sampleRate = 48000.0;
+        juce::AudioBuffer<float> audio;
+    };
+
+    namespace detail
+    {
+        inline void copyToAllChannels (juce::AudioBuffer<float>& buffer)
+        {
+            for (int ch = 1; ch < buffer.getNumChannels(); ++ch)
+                buffer.copyFrom (ch, 0, buffer, 0, 0, buffer.getNumSamples());
+        }
+
+        /** Karplus-Strong pluck train in E2–E4 with pick noise, decays and silent gaps. */
+        inline void fillSyntheticDI (juce::AudioBuffer<float>& buffer, double sampleRate, juce::Random& rng)
+        {
+            buffer.clear();
+            auto* out = buffer.getWritePointer (0);
+            const int numSamples = buffer.getNumSamples();
+
+            int position = 0;
+            while (position < numSamples)
+            {
+                const float frequency = 82.41f * std::pow (2.0f, static_cast<float> (rng.nextInt (25)) / 12.0f);
+                const int   period    = juce::jmax (2, static_cast<int> (sampleRate / frequency));
+                const float level     = 0.1f + 0.4f * rng.nextFloat();
+                const int   length    = static_cast<int> (sampleRate * (0.2 + 0.5 * rng.nextDouble()));
+
+                std::vector<float> line (static_cast<size_t> (period));
+                for (auto& v : line)
+                    v = level * (2.0f * rng.nextFloat() - 1.0f);
+
+                for (int i = 0; i < length && position + i < numSamples; ++i)
+                {
+                    const auto index = static_cast<size_t> (i % period);
+                    const auto next  = static_cast<size_t> ((i + 1) % period);
+                    out[position + i] = line[index];
+                    line[index] = 0.996f * 0.5f * (line[index] + line[next]);
+                }
+
+                // Note length plus a gap the gate should close in
+                position += length + static_cast<int> (sampleRate * 0.15 * rng.nextDouble());
+            }
+
+            copyToAllChannels (buffer);
+        }
+
+        /** Reads the first `seconds` of a DI file as stereo; false if it cannot be read. */
+        inline bool readDI (const juce::File& file, double seconds, TestSignal& signal)
+        {
+            juce::AudioFormatManager formats;
+            formats.registerBasicFormats();
+
+            std::unique_ptr<juce::AudioFormatReader> reader (formats.createReaderFor (file));
+            if (reader == nullptr || reader->lengthInSamples <= 0)
+                return false;
+
+            const int numSamples = static_cast<int> (juce::jmin (reader->lengthInSamples,
+                                                                 static_cast<juce::int64> (reader->sampleRate * seconds)));
+            signal.sampleRate = reader->sampleRate;
+            signal.audio.setSize (2, numSamples);
+            reader->read (&signal.audio, 0, numSamples, 0, true, reader->numChannels > 1);
+
+            if (reader->numChannels == 1)
+                copyToAllChannels (signal.audio);
+
+            return true;
+        }
+    }
+
+    inline std::vector<TestSignal> makeTestSignals (double sampleRate, double seconds, juce::int64 seed,
+                                                    const juce::File& diFile)
+    {
+        juce::Random rng (seed);
+        const int numSamples = juce::jmax (1, static_cast<int> (sampleRate * seconds));
+        std::vector<TestSignal> signals;
+
+        auto add = [&] (const juce::String& name) -> TestSignal&
+        {
+            signals.push_back ({ name, sampleRate, juce::AudioBuffer<float> (2, numSamples) });
+            signals.back().audio.clear();
+            return signals.back();
+        };
+
+        {
+            auto& sweep = add ("sweep");
+            auto* out = sweep.audio.getWritePointer (0);
+            const double f0 = 20.0, f1 = juce::jmin (20000.0, 0.45 * sampleRate);
+            const double k  = std::log (f1 / f0);
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double t     = static_cast<double> (i) / sampleRate;
+                const double phase = juce::MathConstants<double>::twoPi * f0 * seconds / k
+                                     * (std::exp (k * t / seconds) - 1.0);
+                out[i] = 0.5f * static_cast<float> (std::sin (phase));
+            }
+            detail::copyToAllChannels (sweep.audio);
+        }
+
+        {
+            auto& noise = add ("noise");
+            const float level = juce::Decibels::decibelsToGain (-12.0f);
+            for (int ch = 0; ch < noise.audio.getNumChannels(); ++ch)
+                for (int i = 0; i < numSamples; ++i)
+                    noise.audio.setSample (ch, i, level * (2.0f * rng.nextFloat() - 1.0f));
+        }
+
+        {
+            auto& impulses = add ("impulses");
+            for (int i = rng.nextInt (1000); i < numSamples; i += 1000 + rng.nextInt (static_cast<int> (sampleRate / 4)))
+                for (int ch = 0; ch < impulses.audio.getNumChannels(); ++ch)
+                    impulses.audio.setSample (ch, i, rng.nextBool() ? 0.9f : -0.9f);
+        }
+
+        TestSignal di { "guitar-di", sampleRate, {} };
+        if (diFile != juce::File() && detail::readDI (diFile, seconds, di))
+        {
+            signals.push_back (std::move (di));
+        }
+        else
+        {
+            if (diFile != juce::File())
+                std::fprintf (stderr, "Could not read DI file %s — using the synthetic DI\n",
+                              diFile.getFullPathName().toRawUTF8());
+
+            auto& synthetic = add ("synthetic-di");
+            detail::fillSyntheticDI (synthetic.audio, sampleRate, rng);
+        }
+
+        return signals;
+    }
+}
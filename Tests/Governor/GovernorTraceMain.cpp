@@ -0,0 +1,159 @@
+#include <cstdio>
+#include <functional>
+#include "dsp/QualityGovernor.h"
+
+/**
+ * ClaymoreGovernorTests — drives QualityGovernor with synthetic load traces and checks
+ * when it steps down, when it steps back up and that it holds still in between.
+ *
+ * Usage: ClaymoreGovernorTests [--seed=<n>]          (exit code 1 if any trace fails)
+ *
+ * A trace is the instance's cost at full quality (fraction of the block budget), the
+ * cost ratio of each tier below (0.5: half the oversampled work) and a contention
+ * factor over time — how much slower the same work runs because the rest of the
+ * session is competing for the machine. Every 128-sample block at 48 kHz reports
+ * cost × ratio^tier × contention (±5% jitter) as its callback time.
+ *
+ * Traces:
+ *   session contention   one light instance among many (3%), 3x contention for 4 s:
+ *                        all the way down to 2x, then back up to 8x once it ends
+ *   mild contention      the same instance at 1.5x contention: never moves
+ *   heavy instance       70% on its own: one tier down, then holds (35% is inside
+ *                        the hysteresis band)
+ *   2x selected          3x contention with nothing to give back: never moves
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int    blockSize  = 128;
+
+    struct Trace
+    {
+        const char* name;
+        int         maxTier;
+        double      fullQualityLoad;
+        double      tierCostRatio;
+        double      seconds;
+        std::function<double (double)> contentionAt;   // seconds → slowdown factor
+    };
+
+    struct Run
+    {
+        int    stepsDown      = 0;
+        int    stepsUp        = 0;
+        int    deepestTier    = 0;
+        double firstDropAt    = -1.0;   // seconds
+        double lastChangeAt   = -1.0;
+        int    finalTier      = 0;
+    };
+
+    Run runTrace (const Trace& trace, juce::Random& rng)
+    {
+        QualityGovernor governor;
+        governor.prepare (sampleRate);
+        governor.setMaxTier (trace.maxTier);
+
+        Run run;
+        const double budget    = blockSize / sampleRate;
+        const int    numBlocks = static_cast<int> (trace.seconds * sampleRate / blockSize);
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            const double now    = block * budget;
+            const int    before = governor.getTier();
+            const double load   = trace.fullQualityLoad * std::pow (trace.tierCostRatio, before)
+                                    * trace.contentionAt (now) * (0.95 + 0.1 * rng.nextDouble());
+
+            if (! governor.addLoad (load * budget, blockSize))
+                continue;
+
+            const int after = governor.getTier();
+            (after > before ? run.stepsDown : run.stepsUp)++;
+            run.deepestTier  = juce::jmax (run.deepestTier, after);
+            run.lastChangeAt = now;
+
+            if (after > before && run.firstDropAt < 0.0)
+                run.firstDropAt = now;
+        }
+
+        run.finalTier = governor.getTier();
+        return run;
+    }
+
+    bool check (bool condition, const char* what, bool& ok)
+    {
+        if (! condition)
+        {
+            std::printf ("    FAILED: %s\n", what);
+            ok = false;
+        }
+        return condition;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+    juce::Random rng (args.containsOption ("--seed") ? args.getValueForOption ("--seed").getLargeIntValue() : 1);
+
+    bool allOk = true;
+    auto report = [&] (const Trace& trace, const Run& run, bool ok)
+    {
+        std::printf ("%-20s down %d  up %d  deepest %d  final %d  first drop %5.2f s  last change %5.2f s   %s\n",
+                     trace.name, run.stepsDown, run.stepsUp, run.deepestTier, run.finalTier,
+                     run.firstDropAt, run.lastChangeAt, ok ? "ok" : "FAILED");
+        allOk = allOk && ok;
+    };
+
+    // --- Session contention: 2 s calm, 4 s at 3x, 12 s calm ---
+    {
+        const Trace trace { "session contention", 2, 0.03, 0.5, 18.0,
+                            [] (double t) { return t >= 2.0 && t < 6.0 ? 3.0 : 1.0; } };
+        const auto run = runTrace (trace, rng);
+
+        bool ok = true;
+        check (run.firstDropAt >= 2.0 && run.firstDropAt < 3.0, "first step down within 1 s of the contention", ok);
+        check (run.deepestTier == 2, "reaches 2x while contended", ok);
+        check (run.stepsDown == 2 && run.stepsUp == 2, "exactly two steps each way (no oscillation)", ok);
+        check (run.finalTier == 0, "back at full quality after the contention", ok);
+        check (run.lastChangeAt < 14.0, "recovered within 8 s of the contention ending", ok);
+        report (trace, run, ok);
+    }
+
+    // --- Mild contention: below the relative step-down ratio ---
+    {
+        const Trace trace { "mild contention", 2, 0.03, 0.5, 10.0,
+                            [] (double t) { return t >= 2.0 ? 1.5 : 1.0; } };
+        const auto run = runTrace (trace, rng);
+
+        bool ok = true;
+        check (run.stepsDown == 0 && run.stepsUp == 0, "holds full quality", ok);
+        report (trace, run, ok);
+    }
+
+    // --- Heavy instance: absolute pressure, then the hysteresis band ---
+    {
+        const Trace trace { "heavy instance", 2, 0.7, 0.5, 12.0, [] (double) { return 1.0; } };
+        const auto run = runTrace (trace, rng);
+
+        bool ok = true;
+        check (run.stepsDown == 1 && run.stepsUp == 0, "one step down, none back up", ok);
+        check (run.firstDropAt < 1.0, "steps down within 1 s", ok);
+        check (run.finalTier == 1, "holds the lower tier", ok);
+        report (trace, run, ok);
+    }
+
+    // --- 2x selected: nothing below it ---
+    {
+        const Trace trace { "2x selected", 0, 0.03, 0.5, 8.0,
+                            [] (double t) { return t >= 1.0 ? 3.0 : 1.0; } };
+        const auto run = runTrace (trace, rng);
+
+        bool ok = true;
+        check (run.stepsDown == 0, "never steps below 2x", ok);
+        report (trace, run, ok);
+    }
+
+    std::printf ("\n%s\n", allOk ? "All governor traces passed" : "Governor traces FAILED");
+    return allOk ? 0 : 1;
+}
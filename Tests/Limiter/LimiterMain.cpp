@@ -0,0 +1,179 @@
+#include <cstdio>
+#include <juce_dsp/juce_dsp.h>
+#include "dsp/OutputLimiter.h"
+
+/**
+ * ClaymoreLimiterTests — OutputLimiter behaviour checks.
+ *
+ * Usage: ClaymoreLimiterTests          (exit code 1 if any check fails)
+ *
+ *   attack ramp   a step from -12 dBFS to +12 dBFS (DC, stereo, 1 ms lookahead, sample-
+ *                 and true-peak): the output never exceeds the ceiling and the applied
+ *                 gain (output / delayed input) changes by at most (1 - lowest gain) / 16
+ *                 per sample — the attack is spread over a sub-block, not stepped
+ *   true-peak     a sine at fs/4, 45° phase, 1.2 peak (samples at 0.85: no sample over) at
+ *                 96 kHz / 1 ms lookahead — 64-sample sub-blocks, the largest the
+ *                 interpolator history holds. The steady-state gain must bring the true
+ *                 peak to the ceiling; sample-peak mode must leave it alone
+ *   re-enable     true-peak on over a loud passage, off, quiet, then on again: the first
+ *                 quiet block after re-enabling must not be limited by stale history
+ *
+ * Built with AddressSanitizer where the compiler supports it (CMakeLists.txt), so the
+ * interpolator's reads are bounds-checked.
+ */
+namespace
+{
+    constexpr int numChannels = 2;
+    constexpr int blockSize   = 512;
+
+    struct StepResult
+    {
+        float peakOut     = 0.0f;
+        float lowestGain  = 1.0f;
+        float largestStep = 0.0f;   // largest per-sample change of the applied gain
+    };
+
+    StepResult runStep (double sampleRate, bool truePeak)
+    {
+        OutputLimiter limiter;
+        limiter.setTruePeak (truePeak);
+        limiter.prepare ({ sampleRate, static_cast<juce::uint32> (blockSize), static_cast<juce::uint32> (numChannels) });
+
+        const int latency    = limiter.getLatencyInSamples();
+        const int stepAt     = static_cast<int> (sampleRate * 0.1);
+        const int numSamples = stepAt * 2;
+        const float quiet    = juce::Decibels::decibelsToGain (-12.0f);
+        const float loud     = juce::Decibels::decibelsToGain (12.0f);
+
+        juce::AudioBuffer<float> signal (numChannels, numSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            juce::FloatVectorOperations::fill (signal.getWritePointer (ch), quiet, stepAt);
+            juce::FloatVectorOperations::fill (signal.getWritePointer (ch, stepAt), loud, numSamples - stepAt);
+        }
+
+        juce::AudioBuffer<float> output (signal);
+        for (int start = 0; start < numSamples; start += blockSize)
+        {
+            juce::AudioBuffer<float> block (output.getArrayOfWritePointers(), numChannels, start,
+                                            juce::jmin (blockSize, numSamples - start));
+            limiter.process (block);
+        }
+
+        StepResult result;
+        float lastGain = 1.0f;
+
+        for (int n = latency; n < numSamples; ++n)
+        {
+            const float gain = output.getSample (0, n) / signal.getSample (0, n - latency);
+
+            result.peakOut     = juce::jmax (result.peakOut, std::abs (output.getSample (0, n)));
+            result.lowestGain  = juce::jmin (result.lowestGain, gain);
+            result.largestStep = juce::jmax (result.largestStep, std::abs (gain - lastGain));
+            lastGain = gain;
+        }
+
+        return result;
+    }
+
+    /** Sine at fs/4, 45° phase: every sample at peak/√2, the true peak between them. */
+    void fillQuarterRateSine (juce::AudioBuffer<float>& buffer, int offset, float peak)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            for (int n = 0; n < buffer.getNumSamples(); ++n)
+                buffer.setSample (ch, n, peak * std::sin (juce::MathConstants<float>::halfPi * static_cast<float> (n + offset)
+                                                          + juce::MathConstants<float>::pi / 4.0f));
+    }
+
+    /** Lowest gain over the last half of 0.5 s of the fs/4 sine. */
+    float runTruePeak (double sampleRate, bool truePeak, float peak)
+    {
+        OutputLimiter limiter;
+        limiter.setTruePeak (truePeak);
+        limiter.prepare ({ sampleRate, static_cast<juce::uint32> (blockSize), static_cast<juce::uint32> (numChannels) });
+
+        juce::AudioBuffer<float> block (numChannels, blockSize);
+        const int numBlocks = static_cast<int> (sampleRate * 0.5) / blockSize;
+        float lowest = 1.0f;
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            fillQuarterRateSine (block, b * blockSize, peak);
+            limiter.process (block);
+
+            if (b >= numBlocks / 2)
+                lowest = juce::jmin (lowest, limiter.getLowestGainInLastBlock());
+        }
+
+        return lowest;
+    }
+
+    /** Lowest gain in the first quiet block after true-peak is switched back on. */
+    float runReenable (double sampleRate)
+    {
+        OutputLimiter limiter;
+        limiter.setTruePeak (true);
+        limiter.prepare ({ sampleRate, static_cast<juce::uint32> (blockSize), static_cast<juce::uint32> (numChannels) });
+
+        juce::AudioBuffer<float> block (numChannels, blockSize);
+        const int blocksPerSecond = static_cast<int> (sampleRate) / blockSize;
+
+        fillQuarterRateSine (block, 0, 4.0f);
+        limiter.process (block);                       // history now full of +12 dBFS
+
+        limiter.setTruePeak (false);
+        fillQuarterRateSine (block, 0, 0.25f);
+        for (int b = 0; b < blocksPerSecond; ++b)      // release back to unity
+            limiter.process (block);
+
+        limiter.setTruePeak (true);
+        limiter.process (block);
+        return limiter.getLowestGainInLastBlock();
+    }
+}
+
+int main()
+{
+    bool allOk = true;
+
+    std::printf ("%-24s %10s %12s %14s %10s\n", "attack ramp", "peak out", "lowest gain", "largest step", "bound");
+
+    for (const double sampleRate : { 44100.0, 48000.0, 96000.0 })
+    {
+        for (const bool truePeak : { false, true })
+        {
+            const auto r     = runStep (sampleRate, truePeak);
+            const float bound = (1.0f - r.lowestGain) / 16.0f;
+            const bool ok     = r.peakOut <= 1.0f + 1.0e-6f && r.largestStep <= bound;
+
+            std::printf ("%5.1f kHz %-14s %10.6f %12.4f %14.5f %10.5f   %s\n",
+                         sampleRate / 1000.0, truePeak ? "true-peak" : "sample-peak",
+                         r.peakOut, r.lowestGain, r.largestStep, bound, ok ? "ok" : "FAILED");
+            allOk = allOk && ok;
+        }
+    }
+
+    // --- True-peak at 96 kHz / 1 ms: 64-sample sub-blocks ---
+    {
+        const float peak       = 1.2f;
+        const float truePeakTp = runTruePeak (96000.0, true, peak);
+        const float samplePeak = runTruePeak (96000.0, false, peak);
+
+        // Interpolator estimate within ±1% of the true peak; sample peaks are under the ceiling
+        const bool ok = truePeakTp * peak <= 1.01f && truePeakTp * peak >= 0.99f && samplePeak == 1.0f;
+        std::printf ("\n%-24s gain %.4f (true peak out %.4f), sample-peak mode gain %.4f   %s\n",
+                     "true-peak 96 kHz 1 ms", truePeakTp, truePeakTp * peak, samplePeak, ok ? "ok" : "FAILED");
+        allOk = allOk && ok;
+    }
+
+    // --- True-peak re-enabled: no stale history ---
+    {
+        const float lowest = runReenable (48000.0);
+        const bool  ok     = lowest == 1.0f;
+        std::printf ("%-24s first block gain %.4f   %s\n", "true-peak re-enable", lowest, ok ? "ok" : "FAILED");
+        allOk = allOk && ok;
+    }
+
+    std::printf ("\n%s\n", allOk ? "All limiter checks passed" : "Limiter checks FAILED");
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,315 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <juce_events/juce_events.h>
+#include "BenchUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * ClaymorePerfBudgets — fails when ClaymoreProcessor::processBlock() gets slower than the
+ * checked-in baseline (Tests/Performance/budgets.json) allows.
+ *
+ * Usage: ClaymorePerfBudgets --baseline=<file> [--case=<name>] [options]
+ *
+ *   --case=<name>          check one configuration (CTest runs one test per case when
+ *                          configured with -DCLAYMORE_PERF_BUDGET_TESTS=ON)
+ *   --reps=<n>             timed repetitions per case (default 9, after one warm-up)
+ *   --seconds=<s>          audio per repetition (default 1)
+ *   --tolerance=<x>        allowed slowdown over the baseline (default: the file's, 0.25 = +25%)
+ *   --update-baseline      measure every case (or just --case) and rewrite the baseline file
+ *   --allow-debug          measure a Debug build anyway (normally skipped)
+ *
+ * Per case: `reps` timings of the whole signal, outliers more than 3 scaled MADs from the
+ * median dropped, the rest averaged. The baseline also stores a fixed calibration kernel's
+ * speed; the budget is scaled by (calibration now / calibration at baseline) so a slower or
+ * faster runner does not read as a regression:
+ *
+ *   budget = baseline nsPerSample * machine scale * (1 + tolerance)
+ *
+ * A case with no recorded baseline (or a file with no calibration) fails: an unset budget
+ * must not pass CI unnoticed. Record one with --update-baseline on the reference machine.
+ *
+ * Exit codes: 0 within budget, 1 over budget, no baseline recorded (or bad input), 77 skipped
+ * — a Debug build (CTest SKIP_RETURN_CODE).
+ */
+namespace
+{
+    constexpr int skipReturnCode = 77;
+
+    struct BudgetCase
+    {
+        juce::String name;
+        int    clipType          = 0;
+        int    oversamplingIndex = 0;    // 0 = 2x, 1 = 4x, 2 = 8x
+        double sampleRate        = 48000.0;
+        int    blockSize         = 128;
+        int    numChannels       = 2;
+        bool   gate              = false;
+        double nsPerSample       = 0.0;  // 0 = not recorded
+    };
+
+    struct Baseline
+    {
+        juce::var   document;            // kept so --update-baseline preserves unknown fields
+        double      tolerance              = 0.25;
+        double      calibrationNsPerSample = 0.0;
+        std::vector<BudgetCase> cases;
+
+        bool load (const juce::File& file)
+        {
+            document = juce::JSON::parse (file);
+            const auto* budgets = document["budgets"].getArray();
+            if (budgets == nullptr)
+                return false;
+
+            tolerance              = document.getProperty ("tolerance", tolerance);
+            calibrationNsPerSample = document["calibrationNsPerSample"].isVoid() ? 0.0
+                                         : static_cast<double> (document["calibrationNsPerSample"]);
+
+            for (const auto& entry : *budgets)
+            {
+                BudgetCase c;
+                c.name        = entry["name"].toString();
+                c.clipType    = juce::jlimit (0, 7, static_cast<int> (entry["clipType"]));
+                c.sampleRate  = entry["sampleRate"];
+                c.blockSize   = juce::jmax (1, static_cast<int> (entry["blockSize"]));
+                c.numChannels = juce::jlimit (1, 2, static_cast<int> (entry["channels"]));
+                c.gate        = entry["gate"];
+                c.nsPerSample = entry["nsPerSample"].isVoid() ? 0.0 : static_cast<double> (entry["nsPerSample"]);
+
+                const int factor = entry["oversampling"];
+                c.oversamplingIndex = factor >= 8 ? 2 : (factor >= 4 ? 1 : 0);
+
+                if (c.name.isEmpty() || c.sampleRate <= 0.0)
+                    return false;
+
+                cases.push_back (c);
+            }
+
+            return true;
+        }
+
+        bool save (const juce::File& file) const
+        {
+            auto* root = document.getDynamicObject();
+            root->setProperty ("machine", juce::SystemStats::getCpuModel() + " / "
+                                              + juce::SystemStats::getOperatingSystemName());
+            root->setProperty ("calibrationNsPerSample", calibrationNsPerSample);
+
+            auto* budgets = document["budgets"].getArray();
+            for (size_t i = 0; i < cases.size(); ++i)
+                if (auto* entry = (*budgets)[static_cast<int> (i)].getDynamicObject())
+                    entry->setProperty ("nsPerSample", cases[i].nsPerSample);
+
+            return file.replaceWithText (juce::JSON::toString (document) + "\n");
+        }
+    };
+
+    struct Measurement
+    {
+        double nsPerSample = 0.0;
+        int    kept        = 0;
+        int    total       = 0;
+    };
+
+    /** One warm-up run, then `repetitions` timed runs; mean of the runs within 3 scaled MADs. */
+    Measurement measureRobust (int repetitions, const std::function<double()>& runOnce)
+    {
+        runOnce();
+
+        std::vector<double> runs;
+        for (int i = 0; i < repetitions; ++i)
+            runs.push_back (runOnce());
+
+        std::sort (runs.begin(), runs.end());
+        const double median = runs[runs.size() / 2];
+
+        std::vector<double> deviations;
+        for (const auto ns : runs)
+            deviations.push_back (std::abs (ns - median));
+        std::sort (deviations.begin(), deviations.end());
+        const double limit = 3.0 * 1.4826 * deviations[deviations.size() / 2];
+
+        Measurement m;
+        m.total = static_cast<int> (runs.size());
+        for (const auto ns : runs)
+        {
+            if (limit > 0.0 && std::abs (ns - median) > limit)
+                continue;
+
+            m.nsPerSample += ns;
+            ++m.kept;
+        }
+        m.nsPerSample /= juce::jmax (1, m.kept);
+        return m;
+    }
+
+    /**
+     * Fixed scalar workload that does not depend on Claymore's code (a one-pole smoother
+     * into tanh): its speed tracks the runner, not the plugin.
+     */
+    Measurement measureCalibration (int repetitions)
+    {
+        juce::AudioBuffer<float> source (1, 48000);
+        Bench::fillNoise (source, 0.5f);
+        float state = 0.0f;
+
+        return measureRobust (repetitions, [&]
+        {
+            return Bench::timeBlocks (source, 256, 1, [&state] (juce::AudioBuffer<float>& block)
+            {
+                auto* data = block.getWritePointer (0);
+                for (int s = 0; s < block.getNumSamples(); ++s)
+                {
+                    state += 0.1f * (data[s] - state);
+                    data[s] = std::tanh (4.0f * state);
+                }
+            });
+        });
+    }
+
+    Measurement measureCase (const BudgetCase& c, double seconds, int repetitions)
+    {
+        ClaymoreProcessor processor;
+        Bench::setPlainValue (processor.apvts, ParamIDs::clipType,     static_cast<float> (c.clipType));
+        Bench::setPlainValue (processor.apvts, ParamIDs::oversampling, static_cast<float> (c.oversamplingIndex));
+        Bench::setPlainValue (processor.apvts, ParamIDs::gateEnabled,  c.gate ? 1.0f : 0.0f);
+
+        processor.setPlayConfigDetails (c.numChannels, c.numChannels, c.sampleRate, c.blockSize);
+        processor.prepareToPlay (c.sampleRate, c.blockSize);
+
+        const int numSamples = juce::jmax (c.blockSize * 16, static_cast<int> (c.sampleRate * seconds));
+        juce::AudioBuffer<float> source (c.numChannels, numSamples);
+        Bench::fillNoise (source, juce::Decibels::decibelsToGain (-12.0f));
+
+        juce::MidiBuffer midi;
+        const auto m = measureRobust (repetitions, [&]
+        {
+            return Bench::timeBlocks (source, c.blockSize, 1,
+                                      [&] (juce::AudioBuffer<float>& b) { processor.processBlock (b, midi); });
+        });
+
+        processor.releaseResources();
+        return m;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+
+    if (! args.containsOption ("--baseline"))
+    {
+        std::fprintf (stderr, "ClaymorePerfBudgets: --baseline=<budgets.json> is required\n");
+        return 1;
+    }
+
+    const auto baselineFile = juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--baseline"));
+    Baseline baseline;
+    if (! baseline.load (baselineFile))
+    {
+        std::fprintf (stderr, "ClaymorePerfBudgets: could not read %s\n", baselineFile.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+   #if JUCE_DEBUG
+    if (! args.containsOption ("--allow-debug"))
+    {
+        std::printf ("Debug build — performance budgets only apply to Release builds, skipping\n");
+        return skipReturnCode;
+    }
+   #endif
+
+    const int    repetitions = juce::jmax (3, args.containsOption ("--reps") ? args.getValueForOption ("--reps").getIntValue() : 9);
+    const double seconds     = juce::jmax (0.05, args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 1.0);
+    const double tolerance   = args.containsOption ("--tolerance") ? args.getValueForOption ("--tolerance").getDoubleValue()
+                                                                   : baseline.tolerance;
+    const bool   update      = args.containsOption ("--update-baseline");
+    const auto   onlyCase    = args.getValueForOption ("--case");
+
+    // APVTS needs a message manager (parameter timers) even when nothing is displayed
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ScopedNoDenormals noDenormals;
+
+    const auto calibration = measureCalibration (repetitions);
+    const double machineScale = baseline.calibrationNsPerSample > 0.0
+                                    ? juce::jlimit (0.25, 4.0, calibration.nsPerSample / baseline.calibrationNsPerSample)
+                                    : 1.0;
+
+    std::printf ("Calibration %.3f ns/sample (baseline %.3f) -> machine scale %.3f, tolerance +%.0f%%\n",
+                 calibration.nsPerSample, baseline.calibrationNsPerSample, machineScale, tolerance * 100.0);
+    std::printf ("%-40s %10s %10s %10s %7s  %s\n", "case", "ns/sample", "baseline", "budget", "runs", "result");
+
+    // A full update re-records the calibration too; a single-case update keeps the old
+    // reference, so its value is converted back to the baseline machine's speed
+    const bool rebase = onlyCase.isEmpty() || baseline.calibrationNsPerSample <= 0.0;
+
+    int failures = 0, checked = 0;
+
+    if (! update && baseline.calibrationNsPerSample <= 0.0)
+    {
+        std::printf ("FAIL: no calibration recorded in the baseline — run --update-baseline\n");
+        ++failures;
+    }
+
+    for (auto& c : baseline.cases)
+    {
+        if (onlyCase.isNotEmpty() && c.name != onlyCase)
+            continue;
+
+        ++checked;
+        const auto m = measureCase (c, seconds, repetitions);
+        const auto runs = juce::String (m.kept) + "/" + juce::String (m.total);
+
+        if (update)
+        {
+            std::printf ("%-40s %10.2f %10.2f %10s %7s  recorded\n",
+                         c.name.toRawUTF8(), m.nsPerSample, c.nsPerSample, "-", runs.toRawUTF8());
+            c.nsPerSample = rebase ? m.nsPerSample : m.nsPerSample / machineScale;
+            continue;
+        }
+
+        if (c.nsPerSample <= 0.0)
+        {
+            std::printf ("%-40s %10.2f %10s %10s %7s  FAIL (no baseline — run --update-baseline)\n",
+                         c.name.toRawUTF8(), m.nsPerSample, "-", "-", runs.toRawUTF8());
+            ++failures;
+            continue;
+        }
+
+        const double expected = c.nsPerSample * machineScale;
+        const double budget   = expected * (1.0 + tolerance);
+        const bool   over     = m.nsPerSample > budget;
+
+        std::printf ("%-40s %10.2f %10.2f %10.2f %7s  %s (%+.0f%%)\n",
+                     c.name.toRawUTF8(), m.nsPerSample, c.nsPerSample, budget, runs.toRawUTF8(),
+                     over ? "FAIL" : "ok", 100.0 * (m.nsPerSample / expected - 1.0));
+
+        if (over)
+            ++failures;
+    }
+
+    if (checked == 0)
+    {
+        std::fprintf (stderr, "ClaymorePerfBudgets: no case named '%s' in %s\n",
+                      onlyCase.toRawUTF8(), baselineFile.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    if (update)
+    {
+        if (rebase)
+            baseline.calibrationNsPerSample = calibration.nsPerSample;
+
+        if (! baseline.save (baselineFile))
+        {
+            std::fprintf (stderr, "ClaymorePerfBudgets: could not write %s\n", baselineFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+
+        std::printf ("Updated %s\n", baselineFile.getFullPathName().toRawUTF8());
+        return 0;
+    }
+
+    return failures > 0 ? 1 : 0;
+}
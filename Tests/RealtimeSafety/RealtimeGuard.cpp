@@ -0,0 +1,314 @@
+#include "RealtimeGuard.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined (__linux__) && defined (__GLIBC__)
+ #define CLAYMORE_RT_GUARD_FULL 1
+ #include <cerrno>
+ #include <dlfcn.h>
+ #include <pthread.h>
+#else
+ #define CLAYMORE_RT_GUARD_FULL 0
+#endif
+
+#if __has_include (<execinfo.h>)
+ #include <execinfo.h>
+ #define CLAYMORE_RT_GUARD_BACKTRACE 1
+#else
+ #define CLAYMORE_RT_GUARD_BACKTRACE 0
+#endif
+
+/*
+ * Everything in this file runs underneath the allocator and the thread library, so it
+ * uses neither: state is plain thread_local / atomic PODs, the real allocator is reached
+ * through glibc's __libc_* entry points, the real pthread calls through dlsym (RTLD_NEXT),
+ * and stacks are written straight to the stderr file descriptor.
+ */
+
+#if CLAYMORE_RT_GUARD_FULL
+extern "C"
+{
+    void* __libc_malloc   (size_t);
+    void* __libc_calloc   (size_t, size_t);
+    void* __libc_realloc  (void*, size_t);
+    void* __libc_memalign (size_t, size_t);
+    void  __libc_free     (void*);
+}
+#endif
+
+namespace
+{
+    thread_local int  realtimeDepth = 0;
+    thread_local bool reporting     = false;
+
+    std::atomic<int> violationCount    { 0 };
+    std::atomic<int> maxReportedStacks { 10 };
+
+    /** Records a violation if the calling thread is inside a RealtimeGuard::Scope. */
+    void flag (const char* call)
+    {
+        if (realtimeDepth == 0 || reporting)
+            return;
+
+        // Reporting may allocate (backtrace() loads libgcc on first use) — don't recurse
+        reporting = true;
+
+        const int violation = violationCount.fetch_add (1) + 1;
+        if (violation <= maxReportedStacks.load())
+        {
+            std::fprintf (stderr, "\n[RealtimeGuard] %s on a real-time thread (violation %d)\n", call, violation);
+            std::fflush (stderr);
+
+           #if CLAYMORE_RT_GUARD_BACKTRACE
+            void* frames[64];
+            const int numFrames = backtrace (frames, 64);
+            backtrace_symbols_fd (frames + 1, numFrames - 1, 2);   // skip flag() itself
+           #endif
+        }
+
+        reporting = false;
+    }
+
+    void* rawMalloc (size_t size)
+    {
+       #if CLAYMORE_RT_GUARD_FULL
+        return __libc_malloc (size);
+       #else
+        return std::malloc (size);
+       #endif
+    }
+
+    void* rawAlignedMalloc (size_t alignment, size_t size)
+    {
+       #if CLAYMORE_RT_GUARD_FULL
+        return __libc_memalign (alignment, size);
+       #else
+        void* result = nullptr;
+        return posix_memalign (&result, alignment, size) == 0 ? result : nullptr;
+       #endif
+    }
+
+    void rawFree (void* ptr)
+    {
+       #if CLAYMORE_RT_GUARD_FULL
+        __libc_free (ptr);
+       #else
+        std::free (ptr);
+       #endif
+    }
+
+   #if CLAYMORE_RT_GUARD_FULL
+    /** The next definition of `name` after this executable (libc / libpthread), cached. */
+    template <typename Fn>
+    Fn nextFunction (std::atomic<Fn>& cache, const char* name)
+    {
+        auto fn = cache.load (std::memory_order_acquire);
+        if (fn == nullptr)
+        {
+            fn = reinterpret_cast<Fn> (dlsym (RTLD_NEXT, name));
+            cache.store (fn, std::memory_order_release);
+        }
+        return fn;
+    }
+   #endif
+}
+
+//==============================================================================
+namespace RealtimeGuard
+{
+    Scope::Scope()  { ++realtimeDepth; }
+    Scope::~Scope() { --realtimeDepth; }
+
+    int  getViolationCount()                  { return violationCount.load(); }
+    void resetViolations()                    { violationCount.store (0); }
+    void setMaxReportedStacks (int maxStacks) { maxReportedStacks.store (maxStacks); }
+    bool isFullyInterposed()                  { return CLAYMORE_RT_GUARD_FULL != 0; }
+}
+
+//==============================================================================
+// C allocator and blocking pthread calls (glibc)
+
+#if CLAYMORE_RT_GUARD_FULL
+extern "C"
+{
+    void* malloc (size_t size) noexcept
+    {
+        flag ("malloc");
+        return __libc_malloc (size);
+    }
+
+    void* calloc (size_t count, size_t size) noexcept
+    {
+        flag ("calloc");
+        return __libc_calloc (count, size);
+    }
+
+    void* realloc (void* ptr, size_t size) noexcept
+    {
+        flag ("realloc");
+        return __libc_realloc (ptr, size);
+    }
+
+    void free (void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            flag ("free");
+        __libc_free (ptr);
+    }
+
+    int posix_memalign (void** result, size_t alignment, size_t size) noexcept
+    {
+        flag ("posix_memalign");
+        if (alignment % sizeof (void*) != 0 || (alignment & (alignment - 1)) != 0)
+            return EINVAL;
+
+        void* ptr = __libc_memalign (alignment, size);
+        if (ptr == nullptr)
+            return ENOMEM;
+
+        *result = ptr;
+        return 0;
+    }
+
+    void* aligned_alloc (size_t alignment, size_t size) noexcept
+    {
+        flag ("aligned_alloc");
+        return __libc_memalign (alignment, size);
+    }
+
+    void* memalign (size_t alignment, size_t size) noexcept
+    {
+        flag ("memalign");
+        return __libc_memalign (alignment, size);
+    }
+
+    int pthread_mutex_lock (pthread_mutex_t* mutex) noexcept
+    {
+        static std::atomic<int (*) (pthread_mutex_t*)> next { nullptr };
+        flag ("pthread_mutex_lock");
+        return nextFunction (next, "pthread_mutex_lock") (mutex);
+    }
+
+    int pthread_mutex_timedlock (pthread_mutex_t* mutex, const timespec* timeout) noexcept
+    {
+        static std::atomic<int (*) (pthread_mutex_t*, const timespec*)> next { nullptr };
+        flag ("pthread_mutex_timedlock");
+        return nextFunction (next, "pthread_mutex_timedlock") (mutex, timeout);
+    }
+
+    int pthread_rwlock_rdlock (pthread_rwlock_t* lock) noexcept
+    {
+        static std::atomic<int (*) (pthread_rwlock_t*)> next { nullptr };
+        flag ("pthread_rwlock_rdlock");
+        return nextFunction (next, "pthread_rwlock_rdlock") (lock);
+    }
+
+    int pthread_rwlock_wrlock (pthread_rwlock_t* lock) noexcept
+    {
+        static std::atomic<int (*) (pthread_rwlock_t*)> next { nullptr };
+        flag ("pthread_rwlock_wrlock");
+        return nextFunction (next, "pthread_rwlock_wrlock") (lock);
+    }
+
+    int pthread_cond_wait (pthread_cond_t* condition, pthread_mutex_t* mutex)
+    {
+        static std::atomic<int (*) (pthread_cond_t*, pthread_mutex_t*)> next { nullptr };
+        flag ("pthread_cond_wait");
+        return nextFunction (next, "pthread_cond_wait") (condition, mutex);
+    }
+
+    int pthread_cond_timedwait (pthread_cond_t* condition, pthread_mutex_t* mutex, const timespec* timeout)
+    {
+        static std::atomic<int (*) (pthread_cond_t*, pthread_mutex_t*, const timespec*)> next { nullptr };
+        flag ("pthread_cond_timedwait");
+        return nextFunction (next, "pthread_cond_timedwait") (condition, mutex, timeout);
+    }
+}
+#endif
+
+//==============================================================================
+// C++ allocation (every platform)
+
+void* operator new (std::size_t size)
+{
+    flag ("operator new");
+    if (auto* ptr = rawMalloc (size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)
+{
+    flag ("operator new[]");
+    if (auto* ptr = rawMalloc (size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept
+{
+    flag ("operator new (nothrow)");
+    return rawMalloc (size > 0 ? size : 1);
+}
+
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept
+{
+    flag ("operator new[] (nothrow)");
+    return rawMalloc (size > 0 ? size : 1);
+}
+
+void* operator new (std::size_t size, std::align_val_t alignment)
+{
+    flag ("operator new (aligned)");
+    if (auto* ptr = rawAlignedMalloc (static_cast<size_t> (alignment), size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size, std::align_val_t alignment)
+{
+    flag ("operator new[] (aligned)");
+    if (auto* ptr = rawAlignedMalloc (static_cast<size_t> (alignment), size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    flag ("operator new (aligned, nothrow)");
+    return rawAlignedMalloc (static_cast<size_t> (alignment), size > 0 ? size : 1);
+}
+
+void* operator new[] (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    flag ("operator new[] (aligned, nothrow)");
+    return rawAlignedMalloc (static_cast<size_t> (alignment), size > 0 ? size : 1);
+}
+
+void operator delete (void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        flag ("operator delete");
+    rawFree (ptr);
+}
+
+void operator delete[] (void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        flag ("operator delete[]");
+    rawFree (ptr);
+}
+
+void operator delete (void* ptr, std::size_t) noexcept                          { operator delete (ptr); }
+void operator delete[] (void* ptr, std::size_t) noexcept                        { operator delete[] (ptr); }
+void operator delete (void* ptr, const std::nothrow_t&) noexcept                { operator delete (ptr); }
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept              { operator delete[] (ptr); }
+void operator delete (void* ptr, std::align_val_t) noexcept                     { operator delete (ptr); }
+void operator delete[] (void* ptr, std::align_val_t) noexcept                   { operator delete[] (ptr); }
+void operator delete (void* ptr, std::size_t, std::align_val_t) noexcept        { operator delete (ptr); }
+void operator delete[] (void* ptr, std::size_t, std::align_val_t) noexcept      { operator delete[] (ptr); }
+void operator delete (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept   { operator delete (ptr); }
+void operator delete[] (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { operator delete[] (ptr); }
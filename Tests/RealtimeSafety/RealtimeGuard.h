@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * Real-time safety checker for test builds.
+ *
+ * RealtimeGuard.cpp replaces the global allocation and locking entry points of the
+ * executable it is linked into — malloc / calloc / realloc / free / posix_memalign /
+ * aligned_alloc, every operator new / delete, and the blocking pthread calls
+ * (pthread_mutex_lock, pthread_mutex_timedlock, pthread_rwlock_rdlock / wrlock,
+ * pthread_cond_wait / timedwait). The replacements forward to the real implementation and,
+ * when the calling thread is inside a Scope, record a violation and print its call stack
+ * to stderr.
+ *
+ * Wrap exactly the code that must be real-time safe:
+ *
+ *     { RealtimeGuard::Scope realtime;  processor.processBlock (buffer, midi); }
+ *
+ * pthread_mutex_trylock is not flagged — it never blocks, so it is the accepted way for
+ * audio code to touch a lock. Threads other than the one in the Scope are never flagged.
+ *
+ * Coverage: glibc (Linux) gets everything; elsewhere only operator new / delete are
+ * interposed. Link RealtimeGuard.cpp into test executables only — never into the plugin.
+ */
+namespace RealtimeGuard
+{
+    /** Marks the current thread as real-time for the lifetime of the object (nestable). */
+    class Scope
+    {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope (const Scope&) = delete;
+        Scope& operator= (const Scope&) = delete;
+    };
+
+    /** Violations recorded since start-up or the last resetViolations(). */
+    int getViolationCount();
+    void resetViolations();
+
+    /** How many violations print a call stack (the rest are only counted). Default 10. */
+    void setMaxReportedStacks (int maxStacks);
+
+    /** True when malloc and the pthread calls are interposed too (not just operator new). */
+    bool isFullyInterposed();
+}
@@ -0,0 +1,190 @@
+#include <iterator>
+#include <juce_events/juce_events.h>
+#include "PluginProcessor.h"
+#include "RealtimeGuard.h"
+
+/**
+ * ClaymoreRealtimeSafety — drives ClaymoreProcessor the way a hostile host would and
+ * fails if processBlock() allocates, frees or takes a blocking lock (RealtimeGuard.h).
+ *
+ * Usage: ClaymoreRealtimeSafety [--blocks=<n>] [--seed=<n>] [--max-stacks=<n>]
+ *
+ * Only processBlock() runs inside the real-time scope. Everything a host or the editor
+ * does between blocks — parameter writes, gate menu commands, prepareToPlay() — is
+ * allowed to allocate, exactly as in a plugin wrapper.
+ *
+ * Scenarios, each at every sample rate / channel layout / prepared block size below:
+ *   automation storm   most parameters move every block, including clip type,
+ *                      oversampling (crossfade switches) and the limiter mode
+ *   gate menu          bursts of hidden gate setting changes (incl. lookahead toggles),
+ *                      some overflowing the command queue
+ *   editor             metering and analyzer taps toggled on and off
+ *   odd block sizes    1, primes, the prepared size ±1, and blocks several times larger
+ *                      than prepared (processBlock tiles them)
+ *   sample-rate change releaseResources() + prepareToPlay() mid-stream at a new rate
+ */
+namespace
+{
+    constexpr double sampleRates[]       { 22050.0, 44100.0, 48000.0, 96000.0, 192000.0 };
+    constexpr int    preparedBlockSizes[] { 32, 441, 512, 2048 };
+    constexpr int    oddBlockSizes[]      { 1, 2, 3, 7, 31, 127, 257, 1021 };
+
+    struct StressOptions
+    {
+        int         blocksPerRun = 400;
+        juce::int64 seed         = 1;
+    };
+
+    class StressHost
+    {
+    public:
+        StressHost (ClaymoreProcessor& p, juce::Random& r) : processor (p), rng (r) {}
+
+        void prepare (double sampleRate, int blockSize, int numChannels)
+        {
+            preparedBlockSize = blockSize;
+            processor.releaseResources();
+            processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+            processor.prepareToPlay (sampleRate, blockSize);
+
+            // Worst case a host may send — buffers are the host's, allocated up front
+            buffer.setSize (numChannels, blockSize * 4 + 8);
+        }
+
+        void run (int numBlocks)
+        {
+            for (int i = 0; i < numBlocks; ++i)
+            {
+                automate();
+
+                if (rng.nextInt (8) == 0)
+                    changeGateSettings();
+
+                if (rng.nextInt (32) == 0)
+                {
+                    processor.getMetering().setActive (rng.nextBool());
+                    processor.getAnalyzerFeed().setActive (rng.nextBool());
+                }
+
+                processOneBlock (nextBlockSize());
+            }
+        }
+
+    private:
+        /** Host-side parameter writes — outside the real-time scope, like a plugin wrapper. */
+        void automate()
+        {
+            for (auto* parameter : processor.getParameters())
+                if (rng.nextInt (3) != 0)
+                    parameter->setValueNotifyingHost (rng.nextFloat());
+        }
+
+        /** Editor right-click menu changes, sometimes more than the queue holds. */
+        void changeGateSettings()
+        {
+            const int count = rng.nextInt (4) == 0 ? 100 : 1 + rng.nextInt (6);
+            for (int i = 0; i < count; ++i)
+            {
+                switch (rng.nextInt (6))
+                {
+                    case 0:  processor.setGateAttack       (0.1f + 100.0f * rng.nextFloat());  break;
+                    case 1:  processor.setGateRelease      (1.0f + 2000.0f * rng.nextFloat()); break;
+                    case 2:  processor.setGateHysteresis   (12.0f * rng.nextFloat());          break;
+                    case 3:  processor.setGateRange        (-120.0f + 114.0f * rng.nextFloat()); break;
+                    case 4:  processor.setGateSidechainHPF (20.0f + 1980.0f * rng.nextFloat()); break;
+                    default: processor.setGateLookahead    (rng.nextBool());                    break;
+                }
+            }
+        }
+
+        int nextBlockSize()
+        {
+            switch (rng.nextInt (4))
+            {
+                case 0:  return oddBlockSizes[rng.nextInt (static_cast<int> (std::size (oddBlockSizes)))];
+                case 1:  return juce::jmax (1, preparedBlockSize + rng.nextInt (3) - 1);
+                case 2:  return 1 + rng.nextInt (buffer.getNumSamples());
+                default: return preparedBlockSize;
+            }
+        }
+
+        void processOneBlock (int numSamples)
+        {
+            numSamples = juce::jmin (numSamples, buffer.getNumSamples());
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                auto* data = buffer.getWritePointer (ch);
+                for (int s = 0; s < numSamples; ++s)
+                    data[s] = 0.5f * (2.0f * rng.nextFloat() - 1.0f);
+            }
+
+            juce::AudioBuffer<float> block (buffer.getArrayOfWritePointers(), buffer.getNumChannels(), numSamples);
+
+            RealtimeGuard::Scope realtime;
+            processor.processBlock (block, midi);
+        }
+
+        ClaymoreProcessor& processor;
+        juce::Random& rng;
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+        int preparedBlockSize = 512;
+    };
+}
+
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+
+    StressOptions options;
+    if (args.containsOption ("--blocks"))
+        options.blocksPerRun = juce::jmax (1, args.getValueForOption ("--blocks").getIntValue());
+    if (args.containsOption ("--seed"))
+        options.seed = args.getValueForOption ("--seed").getLargeIntValue();
+    if (args.containsOption ("--max-stacks"))
+        RealtimeGuard::setMaxReportedStacks (args.getValueForOption ("--max-stacks").getIntValue());
+
+    if (! RealtimeGuard::isFullyInterposed())
+        std::printf ("Note: only operator new / delete are interposed on this platform\n");
+
+    // APVTS needs a message manager (parameter timers) even when nothing is displayed
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::Random rng (options.seed);
+    int runs = 0;
+
+    for (const int numChannels : { 1, 2 })
+    {
+        ClaymoreProcessor processor;
+        StressHost host (processor, rng);
+
+        for (const double sampleRate : sampleRates)
+        {
+            for (const int blockSize : preparedBlockSizes)
+            {
+                const int before = RealtimeGuard::getViolationCount();
+
+                host.prepare (sampleRate, blockSize, numChannels);
+                host.run (options.blocksPerRun);
+
+                // Sample-rate change mid-stream, then keep going on the same instance
+                const double nextRate = sampleRates[rng.nextInt (static_cast<int> (std::size (sampleRates)))];
+                host.prepare (nextRate, blockSize, numChannels);
+                host.run (options.blocksPerRun / 4);
+
+                const int found = RealtimeGuard::getViolationCount() - before;
+                std::printf ("%d ch  %6.0f Hz (-> %6.0f Hz)  block %4d   %s\n",
+                             numChannels, sampleRate, nextRate, blockSize,
+                             found == 0 ? "ok" : (juce::String (found) + " violations").toRawUTF8());
+                ++runs;
+            }
+        }
+
+        processor.releaseResources();
+    }
+
+    const int violations = RealtimeGuard::getViolationCount();
+    std::printf ("\n%d runs, %d real-time violations inside processBlock()\n", runs, violations);
+    return violations == 0 ? 0 : 1;
+}